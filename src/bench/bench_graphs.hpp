@@ -0,0 +1,194 @@
+/*
+ * bench_graphs.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: graphs and queries used by the benchmarks
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef BENCH_GRAPHS_HPP
+#define BENCH_GRAPHS_HPP
+
+#include <cstdint>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "graph/graph.hpp"
+
+namespace librav
+{
+
+/// A vertex of a benchmark graph, the position is used by the heuristic
+struct BenchState
+{
+	BenchState(int64_t id, double x, double y) : id_(id), x_(x), y_(y){};
+
+	int64_t id_;
+	double x_;
+	double y_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+enum class BenchWorkload
+{
+	// 4-connected grid with unit costs and 25% of the cells blocked
+	Grid,
+	// vertices at random positions, each linked to 3 random vertices
+	Random,
+	// jittered grid with some streets missing, and highways along every 16th row and column
+	Road
+};
+
+/// The edges of a benchmark graph and the graph built from them
+struct BenchGraph
+{
+	typedef std::tuple<BenchState, BenchState, double> EdgeType;
+
+	std::vector<EdgeType> edges_;
+	Graph_t<BenchState> graph_;
+
+	// scale of the Euclidean distance that keeps the heuristic admissible
+	double heuristic_scale_ = 1.0;
+
+	// pairs of vertex ids, both ends of each query exist in the graph
+	std::vector<std::pair<int64_t, int64_t>> queries_;
+
+	double GetHeuristic(const BenchState &state, const BenchState &goal) const
+	{
+		return heuristic_scale_ * std::hypot(state.x_ - goal.x_, state.y_ - goal.y_);
+	}
+};
+
+namespace bench
+{
+inline void AddBothWays(BenchGraph &bench_graph, const BenchState &state1, const BenchState &state2, double cost_scale)
+{
+	double cost = cost_scale * std::hypot(state1.x_ - state2.x_, state1.y_ - state2.y_);
+	bench_graph.edges_.emplace_back(state1, state2, cost);
+	bench_graph.edges_.emplace_back(state2, state1, cost);
+}
+
+inline void GenerateGrid(BenchGraph &bench_graph, int64_t side, std::mt19937 &rng)
+{
+	std::bernoulli_distribution blocked(0.25);
+	std::vector<bool> free_cells(side * side);
+	for (int64_t i = 0; i < side * side; ++i)
+		free_cells[i] = !blocked(rng);
+
+	for (int64_t y = 0; y < side; ++y)
+		for (int64_t x = 0; x < side; ++x)
+		{
+			if (!free_cells[y * side + x])
+				continue;
+			BenchState cell(y * side + x, x, y);
+			if (x + 1 < side && free_cells[y * side + x + 1])
+				AddBothWays(bench_graph, cell, BenchState(y * side + x + 1, x + 1, y), 1.0);
+			if (y + 1 < side && free_cells[(y + 1) * side + x])
+				AddBothWays(bench_graph, cell, BenchState((y + 1) * side + x, x, y + 1), 1.0);
+		}
+	bench_graph.heuristic_scale_ = 1.0;
+}
+
+inline void GenerateRandom(BenchGraph &bench_graph, int64_t vertex_num, int64_t side, std::mt19937 &rng)
+{
+	std::uniform_real_distribution<double> position(0, side);
+	std::uniform_real_distribution<double> detour(1.0, 2.0);
+	std::uniform_int_distribution<int64_t> vertex(0, vertex_num - 1);
+
+	std::vector<BenchState> states;
+	for (int64_t i = 0; i < vertex_num; ++i)
+		states.emplace_back(i, position(rng), position(rng));
+
+	for (int64_t i = 0; i < vertex_num; ++i)
+		for (int k = 0; k < 3; ++k)
+		{
+			int64_t j = vertex(rng);
+			if (j != i)
+				AddBothWays(bench_graph, states[i], states[j], detour(rng));
+		}
+	bench_graph.heuristic_scale_ = 1.0;
+}
+
+inline void GenerateRoad(BenchGraph &bench_graph, int64_t side, std::mt19937 &rng)
+{
+	std::uniform_real_distribution<double> jitter(-0.3, 0.3);
+	std::uniform_real_distribution<double> street(1.0, 1.5);
+	std::bernoulli_distribution missing(0.1);
+
+	const double highway = 0.6;
+	const int64_t highway_gap = 16;
+	const int64_t highway_exit = 8;
+
+	std::vector<BenchState> states;
+	for (int64_t y = 0; y < side; ++y)
+		for (int64_t x = 0; x < side; ++x)
+			states.emplace_back(y * side + x, x + jitter(rng), y + jitter(rng));
+
+	for (int64_t y = 0; y < side; ++y)
+		for (int64_t x = 0; x < side; ++x)
+		{
+			const BenchState &crossing = states[y * side + x];
+			if (x + 1 < side && !missing(rng))
+				AddBothWays(bench_graph, crossing, states[y * side + x + 1], street(rng));
+			if (y + 1 < side && !missing(rng))
+				AddBothWays(bench_graph, crossing, states[(y + 1) * side + x], street(rng));
+
+			// highways are faster than streets and only have an exit at every few crossings
+			if (y % highway_gap == 0 && x % highway_exit == 0 && x + highway_exit < side)
+				AddBothWays(bench_graph, crossing, states[y * side + x + highway_exit], highway);
+			if (x % highway_gap == 0 && y % highway_exit == 0 && y + highway_exit < side)
+				AddBothWays(bench_graph, crossing, states[(y + highway_exit) * side + x], highway);
+		}
+	bench_graph.heuristic_scale_ = highway;
+}
+}
+
+/// The graph of a workload with about vertex_num vertices. Graphs are generated with a fixed
+///	seed when first requested and kept for the following benchmarks.
+inline const BenchGraph &GetBenchGraph(BenchWorkload workload, int64_t vertex_num)
+{
+	static std::map<std::pair<BenchWorkload, int64_t>, std::unique_ptr<BenchGraph>> graphs;
+
+	auto &bench_graph = graphs[std::make_pair(workload, vertex_num)];
+	if (bench_graph != nullptr)
+		return *bench_graph;
+
+	bench_graph.reset(new BenchGraph());
+	std::mt19937 rng(2017);
+	int64_t side = static_cast<int64_t>(std::sqrt(vertex_num));
+	switch (workload)
+	{
+	case BenchWorkload::Grid:
+		bench::GenerateGrid(*bench_graph, side, rng);
+		break;
+	case BenchWorkload::Random:
+		bench::GenerateRandom(*bench_graph, vertex_num, side, rng);
+		break;
+	case BenchWorkload::Road:
+		bench::GenerateRoad(*bench_graph, side, rng);
+		break;
+	}
+
+	bench_graph->graph_.AddEdges(bench_graph->edges_);
+
+	// queries between random vertices, the source of an edge always exists
+	std::uniform_int_distribution<std::size_t> edge(0, bench_graph->edges_.size() - 1);
+	for (int i = 0; i < 64; ++i)
+		bench_graph->queries_.emplace_back(std::get<0>(bench_graph->edges_[edge(rng)]).id_,
+										   std::get<0>(bench_graph->edges_[edge(rng)]).id_);
+
+	return *bench_graph;
+}
+}
+
+#endif /* BENCH_GRAPHS_HPP */
@@ -0,0 +1,96 @@
+/*
+ * graph_bench.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: benchmarks of graph construction and vertex lookup
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "graph/graph.hpp"
+#include "bench/bench_graphs.hpp"
+
+using namespace librav;
+
+// add the edges of a workload one by one, reports edges per second and the memory of the
+//	graph built
+static void BM_AddEdge(benchmark::State &state, BenchWorkload workload)
+{
+	const auto &edges = GetBenchGraph(workload, state.range(0)).edges_;
+	std::size_t memory_size = 0;
+
+	for (auto _ : state)
+	{
+		std::unique_ptr<Graph_t<BenchState>> graph(new Graph_t<BenchState>());
+		for (const auto &edge : edges)
+			graph->AddEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+		benchmark::DoNotOptimize(graph.get());
+
+		// destroying the graph isn't part of the construction
+		state.PauseTiming();
+		memory_size = graph->GetMemorySize();
+		graph.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * edges.size());
+	state.counters["graph_memory_MB"] = memory_size / 1048576.0;
+}
+
+// add the edges of a workload with one call of Graph_t::AddEdges()
+static void BM_AddEdges(benchmark::State &state, BenchWorkload workload)
+{
+	const auto &edges = GetBenchGraph(workload, state.range(0)).edges_;
+	std::size_t memory_size = 0;
+
+	for (auto _ : state)
+	{
+		std::unique_ptr<Graph_t<BenchState>> graph(new Graph_t<BenchState>());
+		graph->AddEdges(edges);
+		benchmark::DoNotOptimize(graph.get());
+
+		state.PauseTiming();
+		memory_size = graph->GetMemorySize();
+		graph.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * edges.size());
+	state.counters["graph_memory_MB"] = memory_size / 1048576.0;
+}
+
+// look up random vertices by id, reports lookups per second
+static void BM_GetVertexFromID(benchmark::State &state, BenchWorkload workload)
+{
+	const auto &bench_graph = GetBenchGraph(workload, state.range(0));
+
+	std::mt19937 rng(2017);
+	std::uniform_int_distribution<std::size_t> edge(0, bench_graph.edges_.size() - 1);
+	std::vector<int64_t> ids(4096);
+	for (auto &id : ids)
+		id = std::get<0>(bench_graph.edges_[edge(rng)]).id_;
+
+	std::size_t i = 0;
+	for (auto _ : state)
+		benchmark::DoNotOptimize(bench_graph.graph_.GetVertexFromID(ids[i++ % ids.size()]));
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+#define GRAPH_BENCHMARK(func) \
+	BENCHMARK_CAPTURE(func, grid, BenchWorkload::Grid)->RangeMultiplier(4)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond); \
+	BENCHMARK_CAPTURE(func, random, BenchWorkload::Random)->RangeMultiplier(4)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond); \
+	BENCHMARK_CAPTURE(func, road, BenchWorkload::Road)->RangeMultiplier(4)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond)
+
+GRAPH_BENCHMARK(BM_AddEdge);
+GRAPH_BENCHMARK(BM_AddEdges);
+
+BENCHMARK_CAPTURE(BM_GetVertexFromID, grid, BenchWorkload::Grid)->RangeMultiplier(4)->Range(1 << 12, 1 << 18);
+BENCHMARK_CAPTURE(BM_GetVertexFromID, random, BenchWorkload::Random)->RangeMultiplier(4)->Range(1 << 12, 1 << 18);
+BENCHMARK_CAPTURE(BM_GetVertexFromID, road, BenchWorkload::Road)->RangeMultiplier(4)->Range(1 << 12, 1 << 18);
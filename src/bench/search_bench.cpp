@@ -0,0 +1,78 @@
+/*
+ * search_bench.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: benchmarks of A* and Dijkstra queries
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+#include "bench/bench_graphs.hpp"
+
+using namespace librav;
+
+// run the queries of a workload in turn with one search context, reports queries per second,
+//	expanded vertices per second, the peak open list size and the memory of the graph
+template <typename SearchFunc>
+void RunSearchBenchmark(benchmark::State &state, const BenchGraph &bench_graph, SearchFunc search)
+{
+	SearchContext context;
+	std::size_t expanded_num = 0;
+	std::size_t max_openlist_size = 0;
+	std::size_t i = 0;
+
+	for (auto _ : state)
+	{
+		const auto &query = bench_graph.queries_[i++ % bench_graph.queries_.size()];
+		auto result = search(context, query.first, query.second);
+		benchmark::DoNotOptimize(result.path_.data());
+
+		expanded_num += result.statistics_.expanded_num_;
+		max_openlist_size = std::max(max_openlist_size, result.statistics_.max_openlist_size_);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+	state.counters["expanded"] = benchmark::Counter(expanded_num, benchmark::Counter::kIsRate);
+	state.counters["expanded_per_query"] = benchmark::Counter(expanded_num, benchmark::Counter::kAvgIterations);
+	state.counters["peak_openlist"] = max_openlist_size;
+	state.counters["vertices"] = bench_graph.graph_.GetVertexNumber();
+	state.counters["graph_memory_MB"] = bench_graph.graph_.GetMemorySize() / 1048576.0;
+}
+
+static void BM_AStarSearch(benchmark::State &state, BenchWorkload workload)
+{
+	const auto &bench_graph = GetBenchGraph(workload, state.range(0));
+	auto heuristic = [&bench_graph](const BenchState &node, const BenchState &goal) {
+		return bench_graph.GetHeuristic(node, goal);
+	};
+
+	RunSearchBenchmark(state, bench_graph, [&](SearchContext &context, int64_t start_id, int64_t goal_id) {
+		return AStar::FindPath(bench_graph.graph_, context, start_id, goal_id, heuristic);
+	});
+}
+
+static void BM_DijkstraSearch(benchmark::State &state, BenchWorkload workload)
+{
+	const auto &bench_graph = GetBenchGraph(workload, state.range(0));
+
+	RunSearchBenchmark(state, bench_graph, [&](SearchContext &context, int64_t start_id, int64_t goal_id) {
+		return Dijkstra::FindPath(bench_graph.graph_, context, start_id, goal_id);
+	});
+}
+
+#define SEARCH_BENCHMARK(func) \
+	BENCHMARK_CAPTURE(func, grid, BenchWorkload::Grid)->RangeMultiplier(4)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMicrosecond); \
+	BENCHMARK_CAPTURE(func, random, BenchWorkload::Random)->RangeMultiplier(4)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMicrosecond); \
+	BENCHMARK_CAPTURE(func, road, BenchWorkload::Road)->RangeMultiplier(4)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMicrosecond)
+
+SEARCH_BENCHMARK(BM_AStarSearch);
+SEARCH_BENCHMARK(BM_DijkstraSearch);
+
+BENCHMARK_MAIN();
@@ -89,6 +89,9 @@ int main(int argc, char **argv)
     for (auto &e : all_edges)
         e.PrintEdge();
 
+    // searches don't print anything unless a log hook is set
+    SetSearchLogHook(PrintSearchLog);
+
     // In order to use A* search, you need to specify how to calculate heuristic
     auto path = AStar::Search(graph, 0, 13, CalcHeuristicFunc_t<BasicState *>(CalcHeuristic));
 
@@ -17,8 +17,7 @@
 #include <algorithm>
 
 // user
-#include "graph/astar.hpp"
-#include "state_example.hpp"
+#include "graph/algorithms/astar.hpp"
 
 using namespace librav;
 
@@ -28,19 +27,25 @@ typedef struct
 	int64_t y;
 } Index;
 
-struct SquareCell: public BDSBase<SquareCell>
+struct SquareCell
 {
 	SquareCell(uint64_t id):
-		BDSBase<SquareCell>(id){};
-	~SquareCell(){};
+		id_(id){};
 
+	uint64_t id_;
 	Index idx;
 
-	double GetHeuristic(const SquareCell& other_struct) const {
-		return std::abs(idx.x - other_struct.idx.x) + std::abs(idx.y - other_struct.idx.y);
+	int64_t GetUniqueID() const
+	{
+		return id_;
 	}
 };
 
+double CalcSquareCellHeuristic(const SquareCell& cell, const SquareCell& goal)
+{
+	return std::abs(cell.idx.x - goal.idx.x) + std::abs(cell.idx.y - goal.idx.y);
+}
+
 // index of square grid: positive x points towards right, positive y points upwards
 class GetSquareCellNeighbour
 {
@@ -118,10 +123,13 @@ int main(int argc, char** argv )
 	obstacle_ids.push_back(18);
 	obstacle_ids.push_back(19);
 
-	auto path = AStar::IncSearch(cell_s, cell_g, GetNeighbourBDSFunc_t<SquareCell>(GetSquareCellNeighbour(5, 5, 1.0, obstacle_ids)));
+	// the graph is generated while it's searched
+	LazyGraph_t<SquareCell> graph(GetSquareCellNeighbour(5, 5, 1.0, obstacle_ids));
+	auto path = AStar::IncSearch(graph, cell_s, cell_g, CalcSquareCellHeuristic);
 
 	for(auto& e : path)
 		std::cout << "id: " << e.GetUniqueID() << std::endl;
+	std::cout << "generated vertices: " << graph.GetVertexNumber() << std::endl;
 
 	return 0;
 }
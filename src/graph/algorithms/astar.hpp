@@ -22,13 +22,13 @@
 #include <algorithm>
 #include <type_traits>
 #include <functional>
-#include <iostream>
 #include <memory>
 
 #include "graph/graph.hpp"
-#include "graph/details/priority_queue.hpp"
-
-// #define MINIMAL_PRINTOUT 1
+#include "graph/csr_graph.hpp"
+#include "graph/lazy_graph.hpp"
+#include "graph/search_context.hpp"
+#include "graph/details/best_first_search.hpp"
 
 namespace librav
 {
@@ -37,48 +37,92 @@ template <typename StateType>
 using CalcHeuristicFunc_t = std::function<double(StateType, StateType)>;
 
 /// A* search algorithm.
+///
+/// The heuristic can be any callable that accepts two states, it's called as
+///	calc_heuristic(const StateType &state, const StateType &goal_state). Pass a lambda or a
+///	functor to have it inlined into the search loop; a CalcHeuristicFunc_t (std::function)
+///	is accepted as well, at the cost of an indirect call per relaxed edge.
+///
+/// The open list can be selected with the first template argument of Search(), for example
+///	Search<IndexedDaryHeap<4>>(...) uses an indexed 4-ary heap with decrease-key instead of
+///	the default PriorityQueue. RadixHeap and BucketQueue are monotone queues for non-negative
+///	(integer) costs, see BestFirstSearch() for details.
+///
+/// The overloads that take a SearchContext or a SearchWorkspace accept a visitor as the last
+///	argument, it's notified when vertices are pushed, popped, expanded and relaxed and can
+///	stop the search early, see NullSearchVisitor. Without visitor the search is unchanged.
+///
+/// IncSearch() searches state spaces that are too large to build up front, the graph is
+///	expanded on demand through a neighbour generator (see LazyGraph_t).
 class AStar
 {
 
   public:
 	/// Search using vertices
-	template <typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType> &graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, std::function<double(StateType, StateType)> calc_heuristic)
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> &graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
 	{
-		// reset last search information
-		graph.ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
 		// start a new search and return result
-		return Search(start, goal, calc_heuristic);
+		return Search<OpenListType>(graph, context, start, goal, calc_heuristic);
 	}
 
-	template <typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType>> graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, std::function<double(StateType, StateType)> calc_heuristic)
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		return Search<OpenListType>(*graph, start, goal, calc_heuristic);
+	}
 
-		// start a new search and return result
-		return Search(start, goal, calc_heuristic);
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> *graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
+	{
+		return Search<OpenListType>(*graph, start, goal, calc_heuristic);
 	}
 
-	template <typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType> *graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, std::function<double(StateType, StateType)> calc_heuristic)
+	/// Search using vertex ids
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> &graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
 		// start a new search and return result
-		return Search(start, goal, calc_heuristic);
+		return Search<OpenListType>(graph, context, start_id, goal_id, calc_heuristic);
 	}
 
-	/// Search using vertex ids
-	template <typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType> &graph, uint64_t start_id, uint64_t goal_id, std::function<double(StateType, StateType)> calc_heuristic)
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		return Search<OpenListType>(*graph, start_id, goal_id, calc_heuristic);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> *graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
 	{
-		// reset last search information
-		graph.ResetGraphVertices();
+		return Search<OpenListType>(*graph, start_id, goal_id, calc_heuristic);
+	}
+
+	/// Search using vertices and a caller-owned search context. The graph is not modified,
+	///	so concurrent searches on the same graph are safe if each uses its own context.
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, SearchContext &context, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
+	{
+		Path_t<StateType, TransitionType> path;
 
+		bool found = BestFirstSearch<OpenListType>(graph, context, start->vertex_index_, goal->vertex_index_, calc_heuristic, visitor);
+		if (found)
+			path = ReconstructPath(graph, context, start, goal);
+		LogSearch("AStar", start->vertex_id_, goal->vertex_id_, found, path.size(), context, goal->vertex_index_);
+
+		return path;
+	}
+
+	/// Search using vertex ids and a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, SearchContext &context, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
+	{
 		auto start = graph.GetVertexFromID(start_id);
 		auto goal = graph.GetVertexFromID(goal_id);
 
@@ -86,144 +130,172 @@ class AStar
 
 		// start a new search and return result
 		if (start != nullptr && goal != nullptr)
-			return Search(start, goal, calc_heuristic);
+			return Search<OpenListType>(graph, context, start, goal, calc_heuristic, visitor);
 		else
 			return empty;
 	}
 
-	template <typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType>> graph, uint64_t start_id, uint64_t goal_id, std::function<double(StateType, StateType)> calc_heuristic)
+	/// Search in a CSR graph using vertex ids, the path is returned as a list of dense vertex indices
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename HeuristicFunc>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType> &graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
+
+		return Search<OpenListType>(graph, context, start_id, goal_id, calc_heuristic);
+	}
+
+	/// Search in a CSR graph using vertex ids and a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType> &graph, SearchContext &context, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		auto start = graph.GetVertexIndex(start_id);
+		auto goal = graph.GetVertexIndex(goal_id);
 
-		auto start = graph->GetVertexFromID(start_id);
-		auto goal = graph->GetVertexFromID(goal_id);
+		typename CsrGraph_t<StateType, TransitionType>::PathType empty;
 
-		Path_t<StateType, TransitionType> empty;
+		if (start == CsrGraph_t<StateType, TransitionType>::InvalidIndex || goal == CsrGraph_t<StateType, TransitionType>::InvalidIndex)
+			return empty;
 
 		// start a new search and return result
-		if (start != nullptr && goal != nullptr)
-			return Search(start, goal, calc_heuristic);
-		else
-			return empty;
+		bool found = BestFirstSearch<OpenListType>(graph, context, start, goal, calc_heuristic, visitor);
+		auto path = found ? context.ReconstructPath(start, goal) : empty;
+		LogSearch("AStar", start_id, goal_id, found, path.size(), context, goal);
+
+		return path;
 	}
 
-	template <typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType> *graph, uint64_t start_id, uint64_t goal_id, std::function<double(StateType, StateType)> calc_heuristic)
+	/// Search using vertex ids, the path is returned together with its cost and the statistics
+	///	of the query
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static SearchResult<Path_t<StateType, TransitionType>> FindPath(const Graph_t<StateType, TransitionType, IDIndexType> &graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
-		auto start = graph->GetVertexFromID(start_id);
-		auto goal = graph->GetVertexFromID(goal_id);
+		return FindPath<OpenListType>(graph, context, start_id, goal_id, calc_heuristic);
+	}
 
-		Path_t<StateType, TransitionType> empty;
+	/// Search using vertex ids and a caller-owned search context, the path is returned together
+	///	with its cost and the statistics of the query
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static SearchResult<Path_t<StateType, TransitionType>> FindPath(const Graph_t<StateType, TransitionType, IDIndexType> &graph, SearchContext &context, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
+	{
+		SearchResult<Path_t<StateType, TransitionType>> result;
 
-		// start a new search and return result
-		if (start != nullptr && goal != nullptr)
-			return Search(start, goal, calc_heuristic);
-		else
-			return empty;
+		auto start = graph.GetVertexFromID(start_id);
+		auto goal = graph.GetVertexFromID(goal_id);
+		if (start == nullptr || goal == nullptr)
+			return result;
+
+		result.path_ = Search<OpenListType>(graph, context, start, goal, calc_heuristic, visitor);
+		result.found_ = !result.path_.empty();
+		result.cost_ = result.found_ ? context.GetSearchInfo(goal->vertex_index_).g_astar_ : 0.0;
+		result.statistics_ = context.GetStatistics();
+
+		return result;
 	}
 
-  private:
-	template <typename StateType>
-	static std::vector<Vertex_t<StateType, double> *> Search(Vertex_t<StateType, double> *start_vtx, Vertex_t<StateType, double> *goal_vtx, std::function<double(StateType, StateType)> CalcHeuristic)
+	/// Search in a CSR graph using vertex ids and a caller-owned search context, the path of
+	///	dense vertex indices is returned together with its cost and the statistics of the query
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static SearchResult<typename CsrGraph_t<StateType, TransitionType>::PathType> FindPath(const CsrGraph_t<StateType, TransitionType> &graph, SearchContext &context, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
 	{
-		using GraphVertexType = Vertex_t<StateType, double>;
+		SearchResult<typename CsrGraph_t<StateType, TransitionType>::PathType> result;
 
-		// open list - a list of vertices that need to be checked out
-		PriorityQueue<GraphVertexType *> openlist;
+		auto goal = graph.GetVertexIndex(goal_id);
+		result.path_ = Search<OpenListType>(graph, context, start_id, goal_id, calc_heuristic, visitor);
+		result.found_ = !result.path_.empty();
+		result.cost_ = result.found_ ? context.GetSearchInfo(goal).g_astar_ : 0.0;
+		result.statistics_ = context.GetStatistics();
 
-		// begin with start vertex
-		openlist.put(start_vtx, 0);
-		start_vtx->is_in_openlist_ = true;
-		start_vtx->g_astar_ = 0;
+		return result;
+	}
 
-		// start search iterations
-		bool found_path = false;
-		GraphVertexType *current_vertex;
-		while (!openlist.empty() && found_path != true)
-		{
-			current_vertex = openlist.get();
-			if (current_vertex->is_checked_)
-				continue;
-			if (current_vertex == goal_vtx)
-			{
-				found_path = true;
-				break;
-			}
-
-			current_vertex->is_in_openlist_ = false;
-			current_vertex->is_checked_ = true;
-
-			// check all adjacent vertices (successors of current vertex)
-			for (auto &edge : current_vertex->edges_to_)
-			{
-				GraphVertexType *successor;
-				successor = edge.dst_;
-
-				// check if the vertex has been checked (in closed list)
-				if (successor->is_checked_ == false)
-				{
-					double new_cost = current_vertex->g_astar_ + edge.cost_;
-
-					// if the vertex is not in open list
-					// or if the vertex is in open list but has a higher cost
-					if (successor->is_in_openlist_ == false || new_cost < successor->g_astar_)
-					{
-						// first set the parent of the adjacent vertex to be the current vertex
-						successor->search_parent_ = current_vertex;
-
-						// update costs
-						successor->g_astar_ = new_cost;
-						successor->h_astar_ = CalcHeuristic(successor->state_, goal_vtx->state_);
-						successor->f_astar_ = successor->g_astar_ + successor->h_astar_;
-
-						// put vertex into open list
-						openlist.put(successor, successor->f_astar_);
-						successor->is_in_openlist_ = true;
-					}
-				}
-			}
-		}
+	/// Search using vertex ids and a caller-owned workspace. The path is written to workspace.path_
+	///	as dense vertex indices, see Graph_t::GetVertexFromIndex(). Once the buffers of the
+	///	workspace are large enough, no memory is allocated by the search.
+	template <typename OpenListType, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static bool Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, SearchWorkspace<OpenListType> &workspace, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
+	{
+		auto start = graph.GetVertexFromID(start_id);
+		auto goal = graph.GetVertexFromID(goal_id);
+
+		workspace.path_.clear();
+		if (start == nullptr || goal == nullptr)
+			return false;
+
+		bool found = BestFirstSearch(graph, workspace, start->vertex_index_, goal->vertex_index_, calc_heuristic, visitor);
+		LogSearch("AStar", start_id, goal_id, found, workspace.path_.size(), workspace.context_, goal->vertex_index_);
+		return found;
+	}
+
+	/// Search in a CSR graph using vertex ids and a caller-owned workspace
+	template <typename OpenListType, typename StateType, typename TransitionType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+	static bool Search(const CsrGraph_t<StateType, TransitionType> &graph, SearchWorkspace<OpenListType> &workspace, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic, VisitorType &&visitor = VisitorType())
+	{
+		auto start = graph.GetVertexIndex(start_id);
+		auto goal = graph.GetVertexIndex(goal_id);
+
+		workspace.path_.clear();
+		if (start == CsrGraph_t<StateType, TransitionType>::InvalidIndex || goal == CsrGraph_t<StateType, TransitionType>::InvalidIndex)
+			return false;
+
+		bool found = BestFirstSearch(graph, workspace, start, goal, calc_heuristic, visitor);
+		LogSearch("AStar", start_id, goal_id, found, workspace.path_.size(), workspace.context_, goal);
+		return found;
+	}
 
-		// reconstruct path from search
-		std::vector<GraphVertexType *> path;
-		if (found_path)
+	/// Search in a graph that is expanded on demand, only the successors of expanded states
+	///	are generated. The generated part of the graph is kept in the LazyGraph_t and reused
+	///	by later queries. The path is returned as a list of states.
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static std::vector<StateType> IncSearch(LazyGraph_t<StateType, TransitionType, IDIndexType> &graph, StateType start, StateType goal, HeuristicFunc calc_heuristic)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
+
+		return IncSearch<OpenListType>(graph, context, start, goal, calc_heuristic);
+	}
+
+	/// Search in a graph that is expanded on demand using a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static std::vector<StateType> IncSearch(LazyGraph_t<StateType, TransitionType, IDIndexType> &graph, SearchContext &context, StateType start, StateType goal, HeuristicFunc calc_heuristic)
+	{
+		std::vector<StateType> path;
+
+		graph.BeginQuery();
+		auto start_vtx = graph.GetVertex(start);
+		auto goal_vtx = graph.GetVertex(goal);
+
+		if (BestFirstSearch<OpenListType>(graph, context, start_vtx->vertex_index_, goal_vtx->vertex_index_, calc_heuristic))
 		{
-			std::cout << "path found" << std::endl;
-			path = ReconstructPath(start_vtx, goal_vtx);
+			for (auto &waypoint : context.ReconstructPath(start_vtx->vertex_index_, goal_vtx->vertex_index_))
+				path.push_back(graph.GetGraph().GetVertexFromIndex(waypoint)->state_);
 		}
-		else
-			std::cout << "failed to find a path" << std::endl;
 
 		return path;
-	};
+	}
 
-	template <typename StateType>
-	static std::vector<Vertex_t<StateType, double> *> ReconstructPath(Vertex_t<StateType, double> *start_vtx, Vertex_t<StateType, double> *goal_vtx)
+	/// Search a graph given by a neighbour generator, e.g. a GetNeighbourFunc_t. Nothing is
+	///	cached after the search, use a LazyGraph_t to reuse the generated graph.
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename NeighbourFunc, typename HeuristicFunc>
+	static std::vector<StateType> IncSearch(StateType start, StateType goal, NeighbourFunc get_neighbours, HeuristicFunc calc_heuristic)
 	{
-		std::vector<Vertex_t<StateType, double> *> path;
-		Vertex_t<StateType, double> *waypoint = goal_vtx;
-		while (waypoint != start_vtx)
-		{
-			path.push_back(waypoint);
-			waypoint = waypoint->search_parent_;
-		}
-		// add the start node
-		path.push_back(waypoint);
-		std::reverse(path.begin(), path.end());
-
-#ifndef MINIMAL_PRINTOUT
-		auto traj_s = path.begin();
-		auto traj_e = path.end() - 1;
-		std::cout << "starting vertex id: " << (*traj_s)->vertex_id_ << std::endl;
-		std::cout << "finishing vertex id: " << (*traj_e)->vertex_id_ << std::endl;
-		std::cout << "path length: " << path.size() << std::endl;
-		std::cout << "total cost: " << path.back()->g_astar_ << std::endl;
-#endif
+		LazyGraph_t<StateType> graph(get_neighbours);
+		SearchContext context;
+
+		return IncSearch<OpenListType>(graph, context, start, goal, calc_heuristic);
+	}
+
+  private:
+	template <typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> ReconstructPath(const Graph_t<StateType, TransitionType, IDIndexType> &graph, const SearchContext &context, Vertex_t<StateType, TransitionType> *start_vtx, Vertex_t<StateType, TransitionType> *goal_vtx)
+	{
+		Path_t<StateType, TransitionType> path;
+		for (auto &waypoint : context.ReconstructPath(start_vtx->vertex_index_, goal_vtx->vertex_index_))
+			path.push_back(graph.GetVertexFromIndex(waypoint));
+
 		return path;
 	}
 };
@@ -0,0 +1,143 @@
+/* 
+ * bidirectional_astar.hpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: bidirectional A* algorithm
+ * Reference:
+ *  	1. A. V. Goldberg and C. Harrelson, Computing the shortest path: A* search meets graph theory, 2005
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef BIDIRECTIONAL_ASTAR_HPP
+#define BIDIRECTIONAL_ASTAR_HPP
+
+#include <vector>
+#include <memory>
+
+#include "graph/graph.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/search_context.hpp"
+#include "graph/details/bidirectional_search.hpp"
+
+namespace librav
+{
+
+/// Bidirectional A* search algorithm.
+///
+/// A forward search from the start and a backward search (along incoming edges) from the
+///	goal run alternately until they meet, see BidirectionalSearch() for details. The
+///	heuristic is called as calc_heuristic(const StateType &state, const StateType &target)
+///	with both the goal and the start as target, so it must be symmetric and consistent
+///	(e.g. the Euclidean or Manhattan distance on a grid).
+///
+/// The open list can be selected with the first template argument of Search() in the same
+///	way as AStar::Search().
+class BidirectionalAStar
+{
+
+  public:
+	/// Search using vertices
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> &graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local BidirectionalSearchContext context;
+
+		return Search<OpenListType>(graph, context, start, goal, calc_heuristic);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
+	{
+		return Search<OpenListType>(*graph, start, goal, calc_heuristic);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> *graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
+	{
+		return Search<OpenListType>(*graph, start, goal, calc_heuristic);
+	}
+
+	/// Search using vertex ids
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> &graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local BidirectionalSearchContext context;
+
+		return Search<OpenListType>(graph, context, start_id, goal_id, calc_heuristic);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		return Search<OpenListType>(*graph, start_id, goal_id, calc_heuristic);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> *graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		return Search<OpenListType>(*graph, start_id, goal_id, calc_heuristic);
+	}
+
+	/// Search using vertices and a caller-owned search context, the cost of the path found
+	///	is stored in context.path_cost_
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, BidirectionalSearchContext &context, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, HeuristicFunc calc_heuristic)
+	{
+		Path_t<StateType, TransitionType> path;
+
+		if (BidirectionalSearch<OpenListType>(graph, context, start->vertex_index_, goal->vertex_index_, calc_heuristic))
+		{
+			for (auto &waypoint : context.ReconstructPath(start->vertex_index_, goal->vertex_index_))
+				path.push_back(graph.GetVertexFromIndex(waypoint));
+		}
+
+		return path;
+	}
+
+	/// Search using vertex ids and a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, BidirectionalSearchContext &context, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		auto start = graph.GetVertexFromID(start_id);
+		auto goal = graph.GetVertexFromID(goal_id);
+
+		Path_t<StateType, TransitionType> empty;
+
+		if (start != nullptr && goal != nullptr)
+			return Search<OpenListType>(graph, context, start, goal, calc_heuristic);
+		else
+			return empty;
+	}
+
+	/// Search in a CSR graph using vertex ids, the path is returned as a list of dense vertex indices
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename HeuristicFunc>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType> &graph, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local BidirectionalSearchContext context;
+
+		return Search<OpenListType>(graph, context, start_id, goal_id, calc_heuristic);
+	}
+
+	/// Search in a CSR graph using vertex ids and a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename HeuristicFunc>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType> &graph, BidirectionalSearchContext &context, uint64_t start_id, uint64_t goal_id, HeuristicFunc calc_heuristic)
+	{
+		auto start = graph.GetVertexIndex(start_id);
+		auto goal = graph.GetVertexIndex(goal_id);
+
+		typename CsrGraph_t<StateType, TransitionType>::PathType empty;
+
+		if (start != CsrGraph_t<StateType, TransitionType>::InvalidIndex && goal != CsrGraph_t<StateType, TransitionType>::InvalidIndex &&
+			BidirectionalSearch<OpenListType>(graph, context, start, goal, calc_heuristic))
+			return context.ReconstructPath(start, goal);
+		else
+			return empty;
+	}
+};
+}
+
+#endif /* BIDIRECTIONAL_ASTAR_HPP */
@@ -0,0 +1,140 @@
+/* 
+ * bidirectional_dijkstra.hpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: bidirectional Dijkstra's algorithm
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef BIDIRECTIONAL_DIJKSTRA_HPP
+#define BIDIRECTIONAL_DIJKSTRA_HPP
+
+#include <vector>
+#include <memory>
+
+#include "graph/graph.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/search_context.hpp"
+#include "graph/details/bidirectional_search.hpp"
+
+namespace librav
+{
+
+/// Bidirectional Dijkstra search algorithm.
+///
+/// A forward search from the start and a backward search (along incoming edges) from the
+///	goal run alternately, expanding the side with the smaller frontier, until no path through
+///	the unexplored vertices can be shorter than the best meeting point found. On graphs
+///	without a useful heuristic this usually settles far fewer vertices than Dijkstra.
+///
+/// The open list can be selected with the first template argument of Search() in the same
+///	way as Dijkstra::Search().
+class BidirectionalDijkstra
+{
+
+  public:
+	/// Search using vertices
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> &graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local BidirectionalSearchContext context;
+
+		return Search<OpenListType>(graph, context, start, goal);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	{
+		return Search<OpenListType>(*graph, start, goal);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> *graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	{
+		return Search<OpenListType>(*graph, start, goal);
+	}
+
+	/// Search using vertex ids
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> &graph, uint64_t start_id, uint64_t goal_id)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local BidirectionalSearchContext context;
+
+		return Search<OpenListType>(graph, context, start_id, goal_id);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, uint64_t start_id, uint64_t goal_id)
+	{
+		return Search<OpenListType>(*graph, start_id, goal_id);
+	}
+
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType> *graph, uint64_t start_id, uint64_t goal_id)
+	{
+		return Search<OpenListType>(*graph, start_id, goal_id);
+	}
+
+	/// Search using vertices and a caller-owned search context, the cost of the path found
+	///	is stored in context.path_cost_
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, BidirectionalSearchContext &context, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	{
+		Path_t<StateType, TransitionType> path;
+
+		if (BidirectionalSearch<OpenListType>(graph, context, start->vertex_index_, goal->vertex_index_, ZeroHeuristic()))
+		{
+			for (auto &waypoint : context.ReconstructPath(start->vertex_index_, goal->vertex_index_))
+				path.push_back(graph.GetVertexFromIndex(waypoint));
+		}
+
+		return path;
+	}
+
+	/// Search using vertex ids and a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType> &graph, BidirectionalSearchContext &context, uint64_t start_id, uint64_t goal_id)
+	{
+		auto start = graph.GetVertexFromID(start_id);
+		auto goal = graph.GetVertexFromID(goal_id);
+
+		Path_t<StateType, TransitionType> empty;
+
+		if (start != nullptr && goal != nullptr)
+			return Search<OpenListType>(graph, context, start, goal);
+		else
+			return empty;
+	}
+
+	/// Search in a CSR graph using vertex ids, the path is returned as a list of dense vertex indices
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType> &graph, uint64_t start_id, uint64_t goal_id)
+	{
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local BidirectionalSearchContext context;
+
+		return Search<OpenListType>(graph, context, start_id, goal_id);
+	}
+
+	/// Search in a CSR graph using vertex ids and a caller-owned search context
+	template <typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType> &graph, BidirectionalSearchContext &context, uint64_t start_id, uint64_t goal_id)
+	{
+		auto start = graph.GetVertexIndex(start_id);
+		auto goal = graph.GetVertexIndex(goal_id);
+
+		typename CsrGraph_t<StateType, TransitionType>::PathType empty;
+
+		if (start != CsrGraph_t<StateType, TransitionType>::InvalidIndex && goal != CsrGraph_t<StateType, TransitionType>::InvalidIndex &&
+			BidirectionalSearch<OpenListType>(graph, context, start, goal, ZeroHeuristic()))
+			return context.ReconstructPath(start, goal);
+		else
+			return empty;
+	}
+};
+}
+
+#endif /* BIDIRECTIONAL_DIJKSTRA_HPP */
@@ -19,59 +19,98 @@
 #include <algorithm>
 #include <type_traits>
 #include <functional>
-#include <iostream>
 #include <memory>
 
 #include "graph/graph.hpp"
-#include "graph/details/priority_queue.hpp"
-
-#define MINIMAL_PRINTOUT 1
+#include "graph/csr_graph.hpp"
+#include "graph/search_context.hpp"
+#include "graph/details/best_first_search.hpp"
 
 namespace librav {
 
 /// Dijkstra search algorithm.
+///
+/// The open list can be selected with the first template argument of Search(), for example
+///	Search<IndexedDaryHeap<4>>(...) uses an indexed 4-ary heap with decrease-key instead of
+///	the default PriorityQueue. RadixHeap and BucketQueue are monotone queues for non-negative
+///	(integer) costs, see BestFirstSearch() for details.
+///
+/// The overloads that take a SearchContext or a SearchWorkspace accept a visitor as the last
+///	argument, it's notified when vertices are pushed, popped, expanded and relaxed and can
+///	stop the search early, see NullSearchVisitor. Without visitor the search is unchanged.
 class Dijkstra{
 
 public:
 
 	/// Search using vertices
-	template<typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType>& graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType>& graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
 	{
-		// reset last search information
-		graph.ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
 		// start a new search and return result
-		return Search(start, goal);
+		return Search<OpenListType>(graph, context, start, goal);
 	}
 
-	template<typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType>> graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		return Search<OpenListType>(*graph, start, goal);
+	}
 
-		// start a new search and return result
-		return Search(start, goal);
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType>* graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	{
+		return Search<OpenListType>(*graph, start, goal);
 	}
 
-	template<typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType>* graph, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal)
+	/// Search using vertex ids
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType>& graph, uint64_t start_id, uint64_t goal_id)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
 		// start a new search and return result
-		return Search(start, goal);
+		return Search<OpenListType>(graph, context, start_id, goal_id);
 	}
 
-	/// Search using vertex ids
-	template<typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType>& graph, uint64_t start_id, uint64_t goal_id)
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType, IDIndexType>> graph, uint64_t start_id, uint64_t goal_id)
 	{
-		// reset last search information
-		graph.ResetGraphVertices();
+		return Search<OpenListType>(*graph, start_id, goal_id);
+	}
 
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType, IDIndexType>* graph, uint64_t start_id, uint64_t goal_id)
+	{
+		return Search<OpenListType>(*graph, start_id, goal_id);
+	}
+
+	/// Search using vertices and a caller-owned search context. The graph is not modified,
+	///	so concurrent searches on the same graph are safe if each uses its own context.
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename VisitorType = NullSearchVisitor>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType>& graph, SearchContext& context, Vertex_t<StateType, TransitionType> *start, Vertex_t<StateType, TransitionType> *goal, VisitorType&& visitor = VisitorType())
+	{
+		Path_t<StateType, TransitionType> path;
+
+		// reconstruct path from search
+		bool found = BestFirstSearch<OpenListType>(graph, context, start->vertex_index_, goal->vertex_index_, ZeroHeuristic(), visitor);
+		if(found)
+		{
+			for(auto& waypoint : context.ReconstructPath(start->vertex_index_, goal->vertex_index_))
+				path.push_back(graph.GetVertexFromIndex(waypoint));
+		}
+		LogSearch("Dijkstra", start->vertex_id_, goal->vertex_id_, found, path.size(), context, goal->vertex_index_);
+
+		return path;
+	}
+
+	/// Search using vertex ids and a caller-owned search context
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename VisitorType = NullSearchVisitor>
+	static Path_t<StateType, TransitionType> Search(const Graph_t<StateType, TransitionType, IDIndexType>& graph, SearchContext& context, uint64_t start_id, uint64_t goal_id, VisitorType&& visitor = VisitorType())
+	{
 		auto start = graph.GetVertexFromID(start_id);
 		auto goal = graph.GetVertexFromID(goal_id);
 
@@ -79,133 +118,121 @@ public:
 
 		// start a new search and return result
 		if(start != nullptr && goal != nullptr)
-			return Search(start, goal);
+			return Search<OpenListType>(graph, context, start, goal, visitor);
 		else
 			return empty;
 	}
 
-	template<typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(std::shared_ptr<Graph_t<StateType, TransitionType>> graph, uint64_t start_id, uint64_t goal_id)
+	/// Search in a CSR graph using vertex ids, the path is returned as a list of dense vertex indices
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType>& graph, uint64_t start_id, uint64_t goal_id)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
-		auto start = graph->GetVertexFromID(start_id);
-		auto goal = graph->GetVertexFromID(goal_id);
+		return Search<OpenListType>(graph, context, start_id, goal_id);
+	}
 
-		Path_t<StateType, TransitionType> empty;
+	/// Search in a CSR graph using vertex ids and a caller-owned search context
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename VisitorType = NullSearchVisitor>
+	static typename CsrGraph_t<StateType, TransitionType>::PathType Search(const CsrGraph_t<StateType, TransitionType>& graph, SearchContext& context, uint64_t start_id, uint64_t goal_id, VisitorType&& visitor = VisitorType())
+	{
+		auto start = graph.GetVertexIndex(start_id);
+		auto goal = graph.GetVertexIndex(goal_id);
 
-		// start a new search and return result
-		if(start != nullptr && goal != nullptr)
-			return Search(start, goal);
-		else
+		typename CsrGraph_t<StateType, TransitionType>::PathType empty;
+
+		if(start == CsrGraph_t<StateType, TransitionType>::InvalidIndex || goal == CsrGraph_t<StateType, TransitionType>::InvalidIndex)
 			return empty;
+
+		// start a new search and return result
+		bool found = BestFirstSearch<OpenListType>(graph, context, start, goal, ZeroHeuristic(), visitor);
+		auto path = found ? context.ReconstructPath(start, goal) : empty;
+		LogSearch("Dijkstra", start_id, goal_id, found, path.size(), context, goal);
+
+		return path;
 	}
 
-	template<typename StateType, typename TransitionType>
-	static Path_t<StateType, TransitionType> Search(Graph_t<StateType, TransitionType>* graph, uint64_t start_id, uint64_t goal_id)
+	/// Search using vertex ids, the path is returned together with its cost and the statistics
+	///	of the query
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType>
+	static SearchResult<Path_t<StateType, TransitionType>> FindPath(const Graph_t<StateType, TransitionType, IDIndexType>& graph, uint64_t start_id, uint64_t goal_id)
 	{
-		// reset last search information
-		graph->ResetGraphVertices();
+		// reuse a per-thread context so that preparing a new search is O(1)
+		static thread_local SearchContext context;
 
-		auto start = graph->GetVertexFromID(start_id);
-		auto goal = graph->GetVertexFromID(goal_id);
+		return FindPath<OpenListType>(graph, context, start_id, goal_id);
+	}
 
-		Path_t<StateType, TransitionType> empty;
+	/// Search using vertex ids and a caller-owned search context, the path is returned together
+	///	with its cost and the statistics of the query
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename IDIndexType, typename VisitorType = NullSearchVisitor>
+	static SearchResult<Path_t<StateType, TransitionType>> FindPath(const Graph_t<StateType, TransitionType, IDIndexType>& graph, SearchContext& context, uint64_t start_id, uint64_t goal_id, VisitorType&& visitor = VisitorType())
+	{
+		SearchResult<Path_t<StateType, TransitionType>> result;
 
-		// start a new search and return result
-		if(start != nullptr && goal != nullptr)
-			return Search(start, goal);
-		else
-			return empty;
+		auto start = graph.GetVertexFromID(start_id);
+		auto goal = graph.GetVertexFromID(goal_id);
+		if(start == nullptr || goal == nullptr)
+			return result;
+
+		result.path_ = Search<OpenListType>(graph, context, start, goal, visitor);
+		result.found_ = !result.path_.empty();
+		result.cost_ = result.found_ ? context.GetSearchInfo(goal->vertex_index_).g_astar_ : 0.0;
+		result.statistics_ = context.GetStatistics();
+
+		return result;
 	}
 
-private:
-	template<typename StateType>
-	static std::vector<Vertex_t<StateType, double>*> Search(Vertex_t<StateType, double> *start_vtx, Vertex_t<StateType, double> *goal_vtx)
+	/// Search in a CSR graph using vertex ids and a caller-owned search context, the path of
+	///	dense vertex indices is returned together with its cost and the statistics of the query
+	template<typename OpenListType = PriorityQueue<uint32_t>, typename StateType, typename TransitionType, typename VisitorType = NullSearchVisitor>
+	static SearchResult<typename CsrGraph_t<StateType, TransitionType>::PathType> FindPath(const CsrGraph_t<StateType, TransitionType>& graph, SearchContext& context, uint64_t start_id, uint64_t goal_id, VisitorType&& visitor = VisitorType())
 	{
-		using GraphVertexType = Vertex_t<StateType, double>;
+		SearchResult<typename CsrGraph_t<StateType, TransitionType>::PathType> result;
+
+		auto goal = graph.GetVertexIndex(goal_id);
+		result.path_ = Search<OpenListType>(graph, context, start_id, goal_id, visitor);
+		result.found_ = !result.path_.empty();
+		result.cost_ = result.found_ ? context.GetSearchInfo(goal).g_astar_ : 0.0;
+		result.statistics_ = context.GetStatistics();
 
-		bool found_path = false;
-		std::vector<GraphVertexType*> path;
-		GraphVertexType* current_vertex;
-		// open list - a list of vertices that need to be checked out
-		PriorityQueue<GraphVertexType*> openlist;
+		return result;
+	}
 
-		openlist.put(start_vtx, 0);
-		start_vtx->is_in_openlist_ = true;
+	/// Search using vertex ids and a caller-owned workspace. The path is written to workspace.path_
+	///	as dense vertex indices, see Graph_t::GetVertexFromIndex(). Once the buffers of the
+	///	workspace are large enough, no memory is allocated by the search.
+	template<typename OpenListType, typename StateType, typename TransitionType, typename IDIndexType, typename VisitorType = NullSearchVisitor>
+	static bool Search(const Graph_t<StateType, TransitionType, IDIndexType>& graph, SearchWorkspace<OpenListType>& workspace, uint64_t start_id, uint64_t goal_id, VisitorType&& visitor = VisitorType())
+	{
+		auto start = graph.GetVertexFromID(start_id);
+		auto goal = graph.GetVertexFromID(goal_id);
 
-		//start->search_parent_ = start;
-		start_vtx->g_astar_ = 0;
+		workspace.path_.clear();
+		if(start == nullptr || goal == nullptr)
+			return false;
 
-		while(!openlist.empty() && found_path != true)
-		{
-			current_vertex = openlist.get();
-			if(current_vertex->is_checked_)
-				continue;
-			if(current_vertex == goal_vtx) {
-				found_path = true;
-				break;
-			}
-
-			current_vertex->is_in_openlist_ = false;
-			current_vertex->is_checked_ = true;
-
-			// check all adjacent vertices (successors of current vertex)
-			for(auto& edge : current_vertex->edges_to_)
-			{
-				GraphVertexType* successor;
-				successor = edge.dst_;
-
-				// check if the vertex has been checked (in closed list)
-				if(successor->is_checked_ == false)
-				{
-					// first set the parent of the adjacent vertex to be the current vertex
-					double new_cost = current_vertex->g_astar_ + edge.cost_;
-
-					// if the vertex is not in open list
-					// or if the vertex is in open list but has a higher cost
-					if(successor->is_in_openlist_ == false || new_cost < successor->g_astar_)
-					{
-						successor->search_parent_ = current_vertex;
-						successor->g_astar_ = new_cost;
-
-						openlist.put(successor, successor->g_astar_);
-						successor->is_in_openlist_ = true;
-					}
-				}
-			}
-		}
+		bool found = BestFirstSearch(graph, workspace, start->vertex_index_, goal->vertex_index_, ZeroHeuristic(), visitor);
+		LogSearch("Dijkstra", start_id, goal_id, found, workspace.path_.size(), workspace.context_, goal->vertex_index_);
+		return found;
+	}
 
-		// reconstruct path from search
-		if(found_path)
-		{
-			std::cout << "path found" << std::endl;
-			GraphVertexType* waypoint = goal_vtx;
-			while(waypoint != start_vtx)
-			{
-				path.push_back(waypoint);
-				waypoint = waypoint->search_parent_;
-			}
-			// add the start node
-			path.push_back(waypoint);
-			std::reverse(path.begin(), path.end());
-
-			auto traj_s = path.begin();
-			auto traj_e = path.end() - 1;
-#ifdef MINIMAL_PRINTOUT
-			std::cout << "starting vertex id: " << (*traj_s)->vertex_id_ << std::endl;
-			std::cout << "finishing vertex id: " << (*traj_e)->vertex_id_ << std::endl;
-			std::cout << "path length: " << path.size() << std::endl;
-			std::cout << "total cost: " << path.back()->g_astar_ << std::endl;
-#endif
-		}
-		else
-			std::cout << "failed to find a path" << std::endl;
+	/// Search in a CSR graph using vertex ids and a caller-owned workspace
+	template<typename OpenListType, typename StateType, typename TransitionType, typename VisitorType = NullSearchVisitor>
+	static bool Search(const CsrGraph_t<StateType, TransitionType>& graph, SearchWorkspace<OpenListType>& workspace, uint64_t start_id, uint64_t goal_id, VisitorType&& visitor = VisitorType())
+	{
+		auto start = graph.GetVertexIndex(start_id);
+		auto goal = graph.GetVertexIndex(goal_id);
 
-		return path;
-	};
+		workspace.path_.clear();
+		if(start == CsrGraph_t<StateType, TransitionType>::InvalidIndex || goal == CsrGraph_t<StateType, TransitionType>::InvalidIndex)
+			return false;
 
+		bool found = BestFirstSearch(graph, workspace, start, goal, ZeroHeuristic(), visitor);
+		LogSearch("Dijkstra", start_id, goal_id, found, workspace.path_.size(), workspace.context_, goal);
+		return found;
+	}
 };
 
 }
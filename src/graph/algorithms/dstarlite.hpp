@@ -0,0 +1,93 @@
+/*
+ * dstarlite.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: D* Lite algorithm
+ * Reference:
+ *  	1. S. Koenig and M. Likhachev, D* Lite, 2002
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef DSTARLITE_HPP
+#define DSTARLITE_HPP
+
+#include <cstdint>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/details/incremental_search.hpp"
+
+namespace librav {
+
+/// D* Lite search algorithm.
+///
+/// D* Lite searches from the goal towards the start, so the search information stays valid
+///	when the start moves along the path. Moving the start only adds the heuristic distance
+///	between the old and the new start to the key modifier k_m, and edge changes only update
+///	the vertices whose distance to the goal is affected. This makes it suitable for an agent
+///	that replans after every step while the map changes.
+///
+/// The heuristic is called as calc_heuristic(state, start_state) and must be consistent and
+///	symmetric, HeuristicFunc can be a functor type to have it inlined. Edge changes must be reported the same way as for LPAStar: UpdateEdgeCost()
+///	changes the cost in the graph, NotifyEdgeChange() updates the search after an edge was
+///	added or removed with Graph_t::AddEdge()/RemoveEdge(). Vertices must not be removed from
+///	the graph while a DStarLite instance refers to it.
+template <typename StateType, typename TransitionType = double, typename HeuristicFunc = CalcHeuristicFunc_t<StateType>, typename IDIndexType = FlatIDIndex>
+class DStarLite : public IncrementalSearchBase<StateType, TransitionType, IDIndexType, HeuristicFunc, true>
+{
+	typedef IncrementalSearchBase<StateType, TransitionType, IDIndexType, HeuristicFunc, true> SearchBase;
+
+  public:
+	DStarLite(Graph_t<StateType, TransitionType, IDIndexType> &graph, HeuristicFunc calc_heuristic) : SearchBase(graph, calc_heuristic) {}
+
+	/// Start a new planning problem, all previous search information is discarded. Returns
+	///	false if the start or the goal is not in the graph.
+	bool SetStartGoal(uint64_t start_id, uint64_t goal_id)
+	{
+		// the search grows from the goal and ends at the start
+		return this->Reset(this->graph_.GetVertexFromID(goal_id), this->graph_.GetVertexFromID(start_id));
+	}
+
+	/// Move the start to another vertex, usually the next vertex on the path. The search
+	///	information is kept. Returns false if the vertex is not in the graph.
+	bool MoveStart(uint64_t start_id)
+	{
+		VertexType *new_start = this->graph_.GetVertexFromID(start_id);
+		if (new_start == nullptr || this->target_ == nullptr)
+			return false;
+
+		// all queued keys become lower bounds of their current value
+		this->key_modifier_ += this->calc_heuristic_(this->target_->state_, new_start->state_);
+		this->target_ = new_start;
+
+		return true;
+	}
+
+	/// Bring the search up to date and return the shortest path from the current start to the
+	///	goal, an empty path is returned if the goal can't be reached
+	Path_t<StateType, TransitionType> ComputeShortestPath() { return this->UpdatePath(); }
+
+	/// Change the cost of an edge in the graph and update the search accordingly
+	bool UpdateEdgeCost(StateType src_node, StateType dst_node, TransitionType cost)
+	{
+		if (!this->graph_.UpdateEdgeCost(src_node, dst_node, cost))
+			return false;
+
+		NotifyEdgeChange(src_node);
+		return true;
+	}
+
+	/// Update the search after an edge from src_node was added, removed or changed in the graph
+	void NotifyEdgeChange(StateType src_node) { this->NotifyChange(GetStateID(src_node)); }
+
+	/// Cost of the shortest path from the current start found by the last call to ComputeShortestPath()
+	double GetPathCost() const { return (this->target_ == nullptr) ? SearchBase::Infinity() : this->GetG(this->target_); }
+
+  private:
+	typedef typename SearchBase::VertexType VertexType;
+};
+
+}
+
+#endif /* DSTARLITE_HPP */
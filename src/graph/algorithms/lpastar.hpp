@@ -1,20 +1,73 @@
-/* 
+/*
  * lpastar.hpp
- * 
- * Created on: Nov 30, 2017 14:21
+ *
+ * Created on: Oct 16, 2026
  * Description: Lifelong Planning A* algorithm
- * 
+ * Reference:
+ *  	1. S. Koenig, M. Likhachev and D. Furcy, Lifelong Planning A*, 2004
+ *
  * Copyright (c) 2017 Ruixiang Du (rdu)
- */ 
+ */
 
 #ifndef LPASTAR_HPP
 #define LPASTAR_HPP
 
+#include <cstdint>
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/details/incremental_search.hpp"
+
 namespace librav {
 
-class LPAStar
+/// Lifelong Planning A* (LPA*) search algorithm.
+///
+/// LPA* keeps the g-values and the one-step lookahead rhs-values of a search between calls
+///	to ComputeShortestPath(). After edge costs change, only the vertices whose distance from
+///	the start is affected are expanded again, so a replan after a few local changes is much
+///	cheaper than running AStar::Search() from scratch.
+///
+/// Edge changes must be reported: UpdateEdgeCost() changes the cost in the graph and updates
+///	the search, NotifyEdgeChange() only updates the search after an edge was added or removed
+///	with Graph_t::AddEdge()/RemoveEdge(). Vertices must not be removed from the graph while
+///	an LPAStar instance refers to it.
+///
+/// HeuristicFunc is called as calc_heuristic(state, goal_state). Give a functor type instead
+///	of the default std::function to have it inlined.
+template <typename StateType, typename TransitionType = double, typename HeuristicFunc = CalcHeuristicFunc_t<StateType>, typename IDIndexType = FlatIDIndex>
+class LPAStar : public IncrementalSearchBase<StateType, TransitionType, IDIndexType, HeuristicFunc, false>
 {
+	typedef IncrementalSearchBase<StateType, TransitionType, IDIndexType, HeuristicFunc, false> SearchBase;
+
+  public:
+	LPAStar(Graph_t<StateType, TransitionType, IDIndexType> &graph, HeuristicFunc calc_heuristic) : SearchBase(graph, calc_heuristic) {}
+
+	/// Start a new planning problem, all previous search information is discarded. Returns
+	///	false if the start or the goal is not in the graph.
+	bool SetStartGoal(uint64_t start_id, uint64_t goal_id)
+	{
+		return this->Reset(this->graph_.GetVertexFromID(start_id), this->graph_.GetVertexFromID(goal_id));
+	}
+
+	/// Bring the search up to date and return the shortest path from start to goal, an
+	///	empty path is returned if the goal can't be reached
+	Path_t<StateType, TransitionType> ComputeShortestPath() { return this->UpdatePath(); }
+
+	/// Change the cost of an edge in the graph and update the search accordingly
+	bool UpdateEdgeCost(StateType src_node, StateType dst_node, TransitionType cost)
+	{
+		if (!this->graph_.UpdateEdgeCost(src_node, dst_node, cost))
+			return false;
+
+		NotifyEdgeChange(dst_node);
+		return true;
+	}
+
+	/// Update the search after an edge to dst_node was added, removed or changed in the graph
+	void NotifyEdgeChange(StateType dst_node) { this->NotifyChange(GetStateID(dst_node)); }
 
+	/// Cost of the shortest path found by the last call to ComputeShortestPath()
+	double GetPathCost() const { return (this->target_ == nullptr) ? SearchBase::Infinity() : this->GetG(this->target_); }
 };
 
 }
@@ -0,0 +1,120 @@
+/*
+ * contraction_hierarchy.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: contraction hierarchies preprocessing and query
+ * Reference:
+ *  	1. R. Geisberger, P. Sanders, D. Schultes and D. Delling, Contraction hierarchies:
+ *  	   faster and simpler hierarchical routing in road networks, 2008
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef CONTRACTION_HIERARCHY_HPP
+#define CONTRACTION_HIERARCHY_HPP
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+#include "graph/graph.hpp"
+#include "graph/search_context.hpp"
+
+namespace librav
+{
+
+/// A contraction hierarchy (CH) of a static Graph_t for fast point-to-point queries.
+///
+/// Preprocessing contracts the vertices one by one in the order of their edge difference
+///	(shortcuts added minus edges removed, plus the number of contracted neighbours). The
+///	priorities are updated lazily and for the neighbours of each contracted vertex, the
+///	initial priorities are computed by several threads. When a vertex is contracted, a
+///	shortcut is added between each pair of its neighbours unless a witness search finds a
+///	path of equal or lower cost that avoids the vertex.
+///
+/// The resulting edges are stored in two CSR arrays: the upward edges (to vertices contracted
+///	later) used by the forward search and the downward edges (from vertices contracted
+///	later) used by the backward search. A query is a bidirectional Dijkstra search that
+///	only moves upwards in the hierarchy, shortcuts on the path are unpacked afterwards.
+///
+/// Vertices are addressed by the vertex index of the source graph (Vertex_t::vertex_index_).
+///	The source graph must outlive the hierarchy and must not be modified after preprocessing,
+///	Search() returns vertices of the source graph.
+template <typename StateType, typename TransitionType = double, typename IDIndexType = FlatIDIndex>
+class ContractionHierarchy_t
+{
+  public:
+	/// Index used for "no vertex", e.g. the middle vertex of an original edge
+	static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+	/// Preprocess the given graph using up to thread_num threads, the calling thread included.
+	///	If a thread can't be started, its share of the work is done by the calling thread.
+	explicit ContractionHierarchy_t(const Graph_t<StateType, TransitionType, IDIndexType> &graph, std::size_t thread_num = std::thread::hardware_concurrency());
+
+	/// Number of shortcuts added by the preprocessing
+	std::size_t GetShortcutNumber() const { return shortcut_num_; }
+
+	/// Position of a vertex in the contraction order, vertices contracted later rank higher
+	uint32_t GetVertexRank(uint32_t vertex_index) const { return rank_[vertex_index]; }
+
+	/// Search using vertex ids, an empty path is returned if no path exists
+	Path_t<StateType, TransitionType> Search(uint64_t start_id, uint64_t goal_id) const;
+
+	/// Search using vertex ids and a caller-owned search context, the cost of the path found
+	///	is stored in context.path_cost_
+	Path_t<StateType, TransitionType> Search(BidirectionalSearchContext &context, uint64_t start_id, uint64_t goal_id) const;
+
+	/// Run a query between two vertex indices, returns true if a path is found. The path can
+	///	be retrieved with UnpackPath() afterwards.
+	bool Query(BidirectionalSearchContext &context, uint32_t start_idx, uint32_t goal_idx) const;
+
+	/// Get the vertex indices of the path found by the last Query() with the shortcuts unpacked
+	std::vector<uint32_t> UnpackPath(const BidirectionalSearchContext &context, uint32_t start_idx, uint32_t goal_idx) const;
+
+  private:
+	// maximum number of vertices settled by a witness search, a shortcut is added if
+	//	no witness is found within the limit
+	static constexpr std::size_t WitnessSettleLimit = 500;
+
+	// an edge of the hierarchy, middle_ is the contracted vertex a shortcut bypasses
+	struct HierarchyEdge
+	{
+		uint32_t vertex_;
+		TransitionType cost_;
+		uint32_t middle_;
+	};
+
+	struct Shortcut
+	{
+		uint32_t src_;
+		uint32_t dst_;
+		TransitionType cost_;
+	};
+
+	const Graph_t<StateType, TransitionType, IDIndexType> *graph_;
+	std::size_t shortcut_num_ = 0;
+	std::vector<uint32_t> rank_;
+
+	// vertex_ of an upward edge is its destination and vertex_ of a downward edge is its
+	//	source, both refer to the vertex with higher rank
+	std::vector<uint32_t> upward_offsets_;
+	std::vector<HierarchyEdge> upward_edges_;
+	std::vector<uint32_t> downward_offsets_;
+	std::vector<HierarchyEdge> downward_edges_;
+
+	// adjacency of the remaining graph, only used during preprocessing
+	std::vector<std::vector<HierarchyEdge>> out_edges_;
+	std::vector<std::vector<HierarchyEdge>> in_edges_;
+
+	void Contract(std::size_t thread_num);
+	void WitnessSearch(SearchContext &context, uint32_t source, uint32_t excluded, double max_cost) const;
+	void FindShortcuts(SearchContext &context, uint32_t vertex, std::vector<Shortcut> &shortcuts) const;
+	void AddHierarchyEdge(uint32_t src, uint32_t dst, TransitionType cost, uint32_t middle);
+	const HierarchyEdge *FindEdge(uint32_t src, uint32_t dst) const;
+};
+}
+
+#include "graph/details/contraction_hierarchy_impl.hpp"
+
+#endif /* CONTRACTION_HIERARCHY_HPP */
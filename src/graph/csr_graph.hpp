@@ -0,0 +1,118 @@
+/*
+ * csr_graph.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: immutable compressed-sparse-row snapshot of a Graph_t
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+
+#include "graph/graph.hpp"
+
+namespace librav
+{
+
+/// A read-only graph in compressed-sparse-row (CSR) layout.
+///
+/// Vertices are renumbered with dense 32-bit indices in [0, GetVertexNumber()). The outgoing
+/// edges of vertex i are stored contiguously in the range [EdgeBegin(i), EdgeEnd(i)) of the
+/// destination and cost arrays, the incoming edges are stored the same way in the reverse
+/// arrays. A CsrGraph_t is built once from a Graph_t (see Graph_t::Freeze())
+/// and doesn't change afterwards, which makes it suitable for search-heavy workloads.
+template <typename StateType, typename TransitionType>
+class CsrGraph_t
+{
+  public:
+	/// A path in a CsrGraph_t is a list of dense vertex indices.
+	typedef std::vector<uint32_t> PathType;
+
+	/// Index returned when a vertex id is not found in the graph.
+	static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+	CsrGraph_t() = default;
+
+	/// Build a CSR snapshot of the given graph. The snapshot copies the states (or the
+	///	pointers/references to the states) so it doesn't depend on the source graph afterwards.
+	template <typename IDIndexType>
+	explicit CsrGraph_t(const Graph_t<StateType, TransitionType, IDIndexType> &graph);
+
+	/// Number of vertices in the graph
+	std::size_t GetVertexNumber() const { return vertex_ids_.size(); }
+
+	/// All vertex indices are smaller than the returned value, same as GetVertexNumber()
+	std::size_t GetVertexIndexBound() const { return vertex_ids_.size(); }
+
+	/// Number of directed edges in the graph
+	std::size_t GetEdgeNumber() const { return edge_dst_.size(); }
+
+	/// Get the dense index of the vertex with specified id, InvalidIndex is returned if not found
+	uint32_t GetVertexIndex(uint64_t vertex_id) const;
+
+	/// Get the id of the vertex at given dense index
+	uint64_t GetVertexID(uint32_t vertex_idx) const { return vertex_ids_[vertex_idx]; }
+
+	/// Get the state associated with the vertex at given dense index
+	const StateType &GetVertexState(uint32_t vertex_idx) const { return states_[vertex_idx]; }
+
+	/// Position of the first outgoing edge of a vertex in the edge arrays
+	uint32_t EdgeBegin(uint32_t vertex_idx) const { return offsets_[vertex_idx]; }
+
+	/// Position one past the last outgoing edge of a vertex in the edge arrays
+	uint32_t EdgeEnd(uint32_t vertex_idx) const { return offsets_[vertex_idx + 1]; }
+
+	/// Destination vertex index of the edge at given position
+	uint32_t EdgeDestination(uint32_t edge_pos) const { return edge_dst_[edge_pos]; }
+
+	/// Cost of the edge at given position
+	TransitionType EdgeCost(uint32_t edge_pos) const { return edge_cost_[edge_pos]; }
+
+	/// Position of the first incoming edge of a vertex in the reverse edge arrays
+	uint32_t ReverseEdgeBegin(uint32_t vertex_idx) const { return reverse_offsets_[vertex_idx]; }
+
+	/// Position one past the last incoming edge of a vertex in the reverse edge arrays
+	uint32_t ReverseEdgeEnd(uint32_t vertex_idx) const { return reverse_offsets_[vertex_idx + 1]; }
+
+	/// Source vertex index of the incoming edge at given position
+	uint32_t ReverseEdgeSource(uint32_t edge_pos) const { return reverse_edge_src_[edge_pos]; }
+
+	/// Cost of the incoming edge at given position
+	TransitionType ReverseEdgeCost(uint32_t edge_pos) const { return reverse_edge_cost_[edge_pos]; }
+
+  private:
+	// states are stored by value, a reference-typed state is kept as a reference_wrapper
+	typedef typename std::conditional<std::is_reference<StateType>::value,
+									  std::reference_wrapper<typename std::remove_reference<StateType>::type>,
+									  StateType>::type StateStorageType;
+
+	// offsets_[i] to offsets_[i+1] is the range of outgoing edges of vertex i
+	std::vector<uint32_t> offsets_;
+	std::vector<uint32_t> edge_dst_;
+	std::vector<TransitionType> edge_cost_;
+
+	// the same edges grouped by destination, used by backward searches
+	std::vector<uint32_t> reverse_offsets_;
+	std::vector<uint32_t> reverse_edge_src_;
+	std::vector<TransitionType> reverse_edge_cost_;
+
+	// dense vertex tables
+	std::vector<uint64_t> vertex_ids_;
+	std::vector<StateStorageType> states_;
+
+	// vertex id to dense index
+	std::unordered_map<uint64_t, uint32_t> id_index_map_;
+};
+}
+
+#include "graph/details/csr_graph_impl.hpp"
+
+#endif /* CSR_GRAPH_HPP */
@@ -0,0 +1,290 @@
+/* 
+ * best_first_search.hpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: search loop shared by AStar and Dijkstra
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef BEST_FIRST_SEARCH_HPP
+#define BEST_FIRST_SEARCH_HPP
+
+#include <cstdint>
+#include <utility>
+#include <chrono>
+
+#include "graph/graph.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/lazy_graph.hpp"
+#include "graph/search_context.hpp"
+#include "graph/search_metrics.hpp"
+#include "graph/details/priority_queue.hpp"
+#include "graph/details/indexed_heap.hpp"
+#include "graph/details/radix_heap.hpp"
+#include "graph/details/bucket_queue.hpp"
+
+namespace librav
+{
+
+/// A heuristic that always returns zero, A* with this heuristic is Dijkstra's algorithm.
+struct ZeroHeuristic
+{
+	template <typename StateType>
+	double operator()(const StateType &, const StateType &) const { return 0.0; }
+};
+
+/****************************************************************************/
+/*							 Graph adapters									*/
+/****************************************************************************/
+/// Call func(dst_index, cost) for every outgoing edge of the vertex with given index
+template <typename StateType, typename TransitionType, typename IDIndexType, typename Func>
+inline void ForEachSuccessor(const Graph_t<StateType, TransitionType, IDIndexType> &graph, uint32_t vertex_index, Func &&func)
+{
+	for (const auto &edge : graph.GetVertexFromIndex(vertex_index)->edges_to_)
+		func(edge.dst_->vertex_index_, edge.cost_);
+}
+
+template <typename StateType, typename TransitionType, typename Func>
+inline void ForEachSuccessor(const CsrGraph_t<StateType, TransitionType> &graph, uint32_t vertex_index, Func &&func)
+{
+	for (uint32_t e = graph.EdgeBegin(vertex_index); e < graph.EdgeEnd(vertex_index); ++e)
+		func(graph.EdgeDestination(e), graph.EdgeCost(e));
+}
+
+/// Call func(src_index, cost) for every incoming edge of the vertex with given index
+template <typename StateType, typename TransitionType, typename IDIndexType, typename Func>
+inline void ForEachPredecessor(const Graph_t<StateType, TransitionType, IDIndexType> &graph, uint32_t vertex_index, Func &&func)
+{
+	for (const auto &edge : graph.GetVertexFromIndex(vertex_index)->edges_from_)
+		func(edge.src_->vertex_index_, edge.cost_);
+}
+
+template <typename StateType, typename TransitionType, typename Func>
+inline void ForEachPredecessor(const CsrGraph_t<StateType, TransitionType> &graph, uint32_t vertex_index, Func &&func)
+{
+	for (uint32_t e = graph.ReverseEdgeBegin(vertex_index); e < graph.ReverseEdgeEnd(vertex_index); ++e)
+		func(graph.ReverseEdgeSource(e), graph.ReverseEdgeCost(e));
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType, typename Func>
+inline void ForEachSuccessor(const LazyGraph_t<StateType, TransitionType, IDIndexType> &graph, uint32_t vertex_index, Func &&func)
+{
+	ForEachSuccessor(graph.GetGraph(), vertex_index, std::forward<Func>(func));
+}
+
+/// Make sure the successors of the vertex with given index exist before they are visited.
+///	Explicit graphs have all successors already, a LazyGraph_t generates them on demand.
+template <typename GraphType>
+inline void ExpandSuccessors(GraphType &, SearchContext &, uint32_t)
+{
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+inline void ExpandSuccessors(LazyGraph_t<StateType, TransitionType, IDIndexType> &graph, SearchContext &context, uint32_t vertex_index)
+{
+	graph.ExpandVertex(graph.GetGraph().GetVertexFromIndex(vertex_index));
+	context.Extend(graph.GetVertexIndexBound());
+}
+
+/// Get the state associated with the vertex with given index
+template <typename StateType, typename TransitionType, typename IDIndexType>
+inline const StateType &GetIndexedState(const Graph_t<StateType, TransitionType, IDIndexType> &graph, uint32_t vertex_index)
+{
+	return graph.GetVertexFromIndex(vertex_index)->state_;
+}
+
+template <typename StateType, typename TransitionType>
+inline const StateType &GetIndexedState(const CsrGraph_t<StateType, TransitionType> &graph, uint32_t vertex_index)
+{
+	return graph.GetVertexState(vertex_index);
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+inline const StateType &GetIndexedState(const LazyGraph_t<StateType, TransitionType, IDIndexType> &graph, uint32_t vertex_index)
+{
+	return graph.GetGraph().GetVertexFromIndex(vertex_index)->state_;
+}
+
+/****************************************************************************/
+/*							 Search visitors								*/
+/****************************************************************************/
+/// A visitor that does nothing, it's used when no visitor is given. All calls are inlined
+///	and removed by the compiler, so a search without visitor costs nothing extra.
+///
+/// A visitor is a type with the same member functions, it's passed by reference and called
+///	with dense vertex indices by the search:
+///	- OnPush(vertex, priority): the vertex is put into the open list
+///	- OnPop(vertex): the vertex is taken from the open list, it may be a stale entry
+///	- OnExpand(vertex): the successors of the vertex are about to be checked. Returning false
+///		stops the search, which then reports that no path was found.
+///	- OnRelax(vertex, successor, cost): a cheaper path to the successor through the vertex is
+///		found, cost is the new cost from the start
+///	- OnGoal(vertex): the goal is taken from the open list and the search succeeds
+struct NullSearchVisitor
+{
+	inline void OnPush(uint32_t, double) {}
+	inline void OnPop(uint32_t) {}
+	inline bool OnExpand(uint32_t) { return true; }
+	inline void OnRelax(uint32_t, uint32_t, double) {}
+	inline void OnGoal(uint32_t) {}
+};
+
+/****************************************************************************/
+/*							 Best-first search								*/
+/****************************************************************************/
+/// Search from start to goal in the given graph, all per-vertex search information is
+///	written to the context. Returns true if the goal is reached, the path can then be
+///	obtained with SearchContext::ReconstructPath().
+///
+/// OpenListType is the priority queue of vertex indices used as open list. It must be default
+///	constructible and provide empty(), put(index, priority) and get(). Queues without
+///	decrease-key may hold several entries of the same vertex, stale entries are skipped when
+///	popped. Available open lists:
+///	- PriorityQueue: binary heap, the default
+///	- IndexedDaryHeap: d-ary heap with decrease-key
+///	- RadixHeap: monotone radix heap for non-negative keys
+///	- BucketQueue: Dial's bucket queue for small integer costs
+///
+/// The open list is owned by the caller and cleared first, so its memory can be reused by the
+///	next search. It needs clear() in addition to the operations listed above.
+///
+/// The visitor is notified of the events of the search, see NullSearchVisitor.
+template <typename OpenListType, typename GraphType, typename HeuristicFunc, typename VisitorType>
+bool BestFirstSearch(GraphType &graph, SearchContext &context, OpenListType &openlist, uint32_t start_idx, uint32_t goal_idx, HeuristicFunc &&calc_heuristic, VisitorType &visitor)
+{
+	const auto start_time = std::chrono::steady_clock::now();
+
+	// reset last search information
+	context.Reset(graph.GetVertexIndexBound());
+	openlist.clear();
+
+	SearchStatistics &statistics = context.GetStatistics();
+	auto finish = [&](bool found) {
+		statistics.search_time_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+		return found;
+	};
+
+	// begin with start vertex
+	SearchInfo &start_info = context.GetSearchInfo(start_idx);
+	openlist.put(start_idx, 0);
+	start_info.is_in_openlist_ = true;
+	start_info.g_astar_ = 0;
+	start_info.search_parent_ = start_idx;
+	statistics.pushed_num_ = 1;
+	statistics.max_openlist_size_ = 1;
+	visitor.OnPush(start_idx, 0);
+
+	const auto &goal_state = GetIndexedState(graph, goal_idx);
+
+	// start search iterations
+	while (!openlist.empty())
+	{
+		uint32_t current = openlist.get();
+		visitor.OnPop(current);
+		if (context.GetSearchInfo(current).is_checked_)
+		{
+			++statistics.stale_pop_num_;
+			continue;
+		}
+		if (current == goal_idx)
+		{
+			visitor.OnGoal(current);
+			return finish(true);
+		}
+		if (!visitor.OnExpand(current))
+			return finish(false);
+		++statistics.expanded_num_;
+
+		// successors of implicit graphs are generated here, which may grow the context
+		ExpandSuccessors(graph, context, current);
+
+		SearchInfo &current_info = context.GetSearchInfo(current);
+
+		current_info.is_in_openlist_ = false;
+		current_info.is_checked_ = true;
+
+		// check all adjacent vertices (successors of current vertex)
+		ForEachSuccessor(graph, current, [&](uint32_t successor, double cost) {
+			SearchInfo &successor_info = context.GetSearchInfo(successor);
+
+			// check if the vertex has been checked (in closed list)
+			if (successor_info.is_checked_)
+				return;
+
+			double new_cost = current_info.g_astar_ + cost;
+
+			// if the vertex is not in open list
+			// or if the vertex is in open list but has a higher cost
+			if (successor_info.is_in_openlist_ == false || new_cost < successor_info.g_astar_)
+			{
+				visitor.OnRelax(current, successor, new_cost);
+
+				// first set the parent of the adjacent vertex to be the current vertex
+				successor_info.search_parent_ = current;
+
+				// the heuristic of a vertex doesn't change, the state is only read when the
+				//	vertex is reached for the first time
+				if (successor_info.is_in_openlist_ == false)
+					successor_info.h_astar_ = calc_heuristic(GetIndexedState(graph, successor), goal_state);
+
+				// update costs
+				successor_info.g_astar_ = new_cost;
+				successor_info.f_astar_ = successor_info.g_astar_ + successor_info.h_astar_;
+
+				// put vertex into open list
+				openlist.put(successor, successor_info.f_astar_);
+				successor_info.is_in_openlist_ = true;
+				visitor.OnPush(successor, successor_info.f_astar_);
+
+				++statistics.pushed_num_;
+				if (openlist.size() > statistics.max_openlist_size_)
+					statistics.max_openlist_size_ = openlist.size();
+			}
+		});
+	}
+
+	return finish(false);
+}
+
+/// Pass the summary of a query to the search log hook, if one is set, and record it in the
+///	search metrics if they are enabled
+inline void LogSearch(const char *algorithm, uint64_t start_id, uint64_t goal_id, bool found, std::size_t path_length, const SearchContext &context, uint32_t goal_idx)
+{
+	SearchMetrics &metrics = GetSearchMetrics();
+	if (metrics.IsEnabled())
+		metrics.Record(algorithm, found, context.GetStatistics());
+
+	const SearchLogFunc &hook = GetSearchLogHook();
+	if (hook)
+	{
+		double cost = found ? context.GetSearchInfo(goal_idx).g_astar_ : 0.0;
+		hook(SearchLogRecord{algorithm, start_id, goal_id, found, path_length, cost, context.GetStatistics()});
+	}
+}
+
+/// Search with an open list that only lives during the search
+template <typename OpenListType, typename GraphType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+bool BestFirstSearch(GraphType &graph, SearchContext &context, uint32_t start_idx, uint32_t goal_idx, HeuristicFunc &&calc_heuristic, VisitorType &&visitor = VisitorType())
+{
+	// open list - a list of vertices that need to be checked out
+	OpenListType openlist;
+
+	return BestFirstSearch(graph, context, openlist, start_idx, goal_idx, std::forward<HeuristicFunc>(calc_heuristic), visitor);
+}
+
+/// Search with the buffers of a workspace, the path is written to workspace.path_. No memory
+///	is allocated once the buffers are large enough for the query.
+template <typename OpenListType, typename GraphType, typename HeuristicFunc, typename VisitorType = NullSearchVisitor>
+bool BestFirstSearch(GraphType &graph, SearchWorkspace<OpenListType> &workspace, uint32_t start_idx, uint32_t goal_idx, HeuristicFunc &&calc_heuristic, VisitorType &&visitor = VisitorType())
+{
+	workspace.path_.clear();
+	if (!BestFirstSearch(graph, workspace.context_, workspace.openlist_, start_idx, goal_idx, std::forward<HeuristicFunc>(calc_heuristic), visitor))
+		return false;
+
+	workspace.context_.ReconstructPath(start_idx, goal_idx, workspace.path_);
+	return true;
+}
+}
+
+#endif /* BEST_FIRST_SEARCH_HPP */
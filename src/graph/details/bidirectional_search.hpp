@@ -0,0 +1,146 @@
+/* 
+ * bidirectional_search.hpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: search loop shared by BidirectionalDijkstra and BidirectionalAStar
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef BIDIRECTIONAL_SEARCH_HPP
+#define BIDIRECTIONAL_SEARCH_HPP
+
+#include <cstdint>
+#include <limits>
+
+#include "graph/search_context.hpp"
+#include "graph/details/best_first_search.hpp"
+
+namespace librav
+{
+
+/// Search from start and goal at the same time, the forward search follows outgoing edges
+///	from the start and the backward search follows incoming edges from the goal. Returns
+///	true if a path is found, its cost and the meeting vertex are stored in the context.
+///
+/// Both searches run on edge costs reduced by the average potential
+///	p(v) = (h(v, goal) - h(v, start)) / 2 (forward) and -p(v) (backward), which is consistent
+///	in both directions if the heuristic is (Goldberg and Harrelson, 2005). The heuristic is
+///	therefore also used to estimate the distance from the start to a vertex and should be
+///	symmetric. With ZeroHeuristic this is bidirectional Dijkstra. All keys put into the open
+///	lists are non-negative and monotone, so any open list policy can be used.
+template <typename OpenListType, typename GraphType, typename HeuristicFunc>
+bool BidirectionalSearch(const GraphType &graph, BidirectionalSearchContext &context, uint32_t start_idx, uint32_t goal_idx, HeuristicFunc &&calc_heuristic)
+{
+	// reset last search information
+	context.forward_.Reset(graph.GetVertexIndexBound());
+	context.backward_.Reset(graph.GetVertexIndexBound());
+
+	const auto &start_state = GetIndexedState(graph, start_idx);
+	const auto &goal_state = GetIndexedState(graph, goal_idx);
+	auto calc_potential = [&](uint32_t vertex) {
+		const auto &state = GetIndexedState(graph, vertex);
+		return 0.5 * (calc_heuristic(state, goal_state) - calc_heuristic(state, start_state));
+	};
+
+	// keys are shifted so that the start of each direction has key 0
+	const double start_potential = calc_potential(start_idx);
+	const double goal_potential = calc_potential(goal_idx);
+
+	OpenListType forward_openlist;
+	OpenListType backward_openlist;
+
+	SearchInfo &start_info = context.forward_.GetSearchInfo(start_idx);
+	start_info.is_in_openlist_ = true;
+	start_info.search_parent_ = start_idx;
+	start_info.h_astar_ = start_potential;
+	forward_openlist.put(start_idx, 0);
+
+	SearchInfo &goal_info = context.backward_.GetSearchInfo(goal_idx);
+	goal_info.is_in_openlist_ = true;
+	goal_info.search_parent_ = goal_idx;
+	goal_info.h_astar_ = -goal_potential;
+	backward_openlist.put(goal_idx, 0);
+
+	// best path found so far
+	double best_cost = std::numeric_limits<double>::infinity();
+	if (start_idx == goal_idx)
+	{
+		best_cost = 0;
+		context.meeting_vertex_ = start_idx;
+	}
+
+	// the last keys popped from each direction are lower bounds of the keys left in the open lists
+	double forward_key = 0;
+	double backward_key = 0;
+
+	while (!forward_openlist.empty() && !backward_openlist.empty())
+	{
+		// expand the direction with the smaller frontier
+		const bool forward = forward_openlist.size() <= backward_openlist.size();
+		OpenListType &openlist = forward ? forward_openlist : backward_openlist;
+		SearchContext &this_side = forward ? context.forward_ : context.backward_;
+		SearchContext &other_side = forward ? context.backward_ : context.forward_;
+		const double potential_sign = forward ? 1.0 : -1.0;
+		const double key_offset = forward ? start_potential : -goal_potential;
+
+		uint32_t current = openlist.get();
+		SearchInfo &current_info = this_side.GetSearchInfo(current);
+		if (current_info.is_checked_)
+			continue;
+
+		// no unexplored path can be shorter than the best one found so far, the best cost
+		//	is compared in reduced costs as well
+		if (current_info.f_astar_ + (forward ? backward_key : forward_key) >= best_cost - start_potential + goal_potential)
+			break;
+		(forward ? forward_key : backward_key) = current_info.f_astar_;
+
+		current_info.is_in_openlist_ = false;
+		current_info.is_checked_ = true;
+
+		auto relax = [&](uint32_t neighbour, double cost) {
+			SearchInfo &neighbour_info = this_side.GetSearchInfo(neighbour);
+
+			// check if the vertex has been checked (in closed list)
+			if (neighbour_info.is_checked_)
+				return;
+
+			double new_cost = current_info.g_astar_ + cost;
+			if (neighbour_info.is_in_openlist_ == false || new_cost < neighbour_info.g_astar_)
+			{
+				// the potential of a vertex is computed once per direction
+				if (neighbour_info.is_in_openlist_ == false)
+					neighbour_info.h_astar_ = potential_sign * calc_potential(neighbour);
+
+				neighbour_info.search_parent_ = current;
+				neighbour_info.g_astar_ = new_cost;
+				neighbour_info.f_astar_ = new_cost + neighbour_info.h_astar_ - key_offset;
+
+				openlist.put(neighbour, neighbour_info.f_astar_);
+				neighbour_info.is_in_openlist_ = true;
+
+				// check if the two searches meet at the vertex
+				if (other_side.IsVisited(neighbour))
+				{
+					const SearchInfo &other_info = other_side.GetSearchInfo(neighbour);
+					if (new_cost + other_info.g_astar_ < best_cost)
+					{
+						best_cost = new_cost + other_info.g_astar_;
+						context.meeting_vertex_ = neighbour;
+					}
+				}
+			}
+		};
+
+		if (forward)
+			ForEachSuccessor(graph, current, relax);
+		else
+			ForEachPredecessor(graph, current, relax);
+	}
+
+	context.path_cost_ = best_cost;
+	return best_cost < std::numeric_limits<double>::infinity();
+}
+}
+
+#endif /* BIDIRECTIONAL_SEARCH_HPP */
@@ -0,0 +1,166 @@
+/*
+ * bucket_queue.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: bucket queue for Dial's algorithm
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef BUCKET_QUEUE_HPP
+#define BUCKET_QUEUE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+namespace librav
+{
+
+/// A monotone bucket queue (Dial's algorithm) that can be used as A* open list.
+///
+/// It's meant for small integer edge costs: the integer part of a priority is used directly
+///	as the bucket position in a circular array of buckets. As long as the span between the
+///	lowest and the highest queued priority stays below the number of buckets, put and get
+///	are O(1) for integer priorities; the array doubles its size when a wider span shows up,
+///	up to MaxBucketNum buckets. Priorities beyond that window, e.g. from a few edges with a
+///	very large cost, are kept in an overflow heap at O(log n) and moved into the buckets once
+///	the window reaches them, so the memory doesn't depend on the magnitude of the costs.
+///	Priorities must not decrease below the last popped one (they are clamped to its bucket),
+///	which holds for Dijkstra's algorithm and A* with a consistent heuristic.
+///
+/// Each bucket is a small binary heap, so fractional priorities are still popped in exact
+///	order and searches stay optimal. Their cost is O(log n) in the size of a bucket.
+///
+/// Like PriorityQueue there is no decrease-key, stale entries are skipped by the search.
+template <typename Number = double>
+class BucketQueue
+{
+  public:
+	static constexpr std::size_t MaxBucketNum = std::size_t(1) << 16;
+
+	explicit BucketQueue(std::size_t bucket_num = 64) : current_(0), size_(0), window_size_(0)
+	{
+		std::size_t capacity = 1;
+		while (capacity < std::min(bucket_num, MaxBucketNum))
+			capacity <<= 1;
+		buckets_.resize(capacity);
+	}
+
+	inline bool empty() const { return size_ == 0; }
+
+	inline std::size_t size() const { return size_; }
+
+	inline void put(uint32_t item, Number priority)
+	{
+		uint64_t key = GetKey(priority);
+		if (key < current_)
+			key = current_;
+		if (key - current_ >= buckets_.size() && buckets_.size() < MaxBucketNum)
+			Grow(std::min<uint64_t>(key - current_ + 1, MaxBucketNum));
+		++size_;
+
+		if (key - current_ >= buckets_.size())
+		{
+			overflow_.emplace_back(priority, item);
+			std::push_heap(overflow_.begin(), overflow_.end(), std::greater<BucketElement>());
+		}
+		else
+			PutInBucket(key, BucketElement(priority, item));
+	}
+
+	inline uint32_t get()
+	{
+		// the window is empty, move it to the lowest overflowing priority
+		if (window_size_ == 0)
+			current_ = std::max(current_, GetKey(overflow_.front().first));
+		TakeOverflow();
+
+		const uint64_t mask = buckets_.size() - 1;
+		while (buckets_[current_ & mask].empty())
+		{
+			++current_;
+			TakeOverflow();
+		}
+
+		auto &bucket = buckets_[current_ & mask];
+		std::pop_heap(bucket.begin(), bucket.end(), std::greater<BucketElement>());
+		uint32_t best_item = bucket.back().second;
+		bucket.pop_back();
+		--window_size_;
+		--size_;
+		return best_item;
+	}
+
+	inline void clear()
+	{
+		for (auto &bucket : buckets_)
+			bucket.clear();
+		overflow_.clear();
+		current_ = 0;
+		size_ = 0;
+		window_size_ = 0;
+	}
+
+  private:
+	typedef std::pair<Number, uint32_t> BucketElement;
+
+	std::vector<std::vector<BucketElement>> buckets_;
+	// entries with a key beyond the window of the buckets, a binary heap
+	std::vector<BucketElement> overflow_;
+	uint64_t current_;
+	std::size_t size_;
+	std::size_t window_size_;
+
+	// the integer part of a priority, huge priorities share the last key
+	static uint64_t GetKey(Number priority)
+	{
+		const Number max_key = static_cast<Number>(uint64_t(1) << 62);
+		if (!(priority > 0))
+			return 0;
+		return priority < max_key ? static_cast<uint64_t>(priority) : (uint64_t(1) << 62);
+	}
+
+	inline void PutInBucket(uint64_t key, const BucketElement &element)
+	{
+		auto &bucket = buckets_[key & (buckets_.size() - 1)];
+		bucket.push_back(element);
+		std::push_heap(bucket.begin(), bucket.end(), std::greater<BucketElement>());
+		++window_size_;
+	}
+
+	// move the overflowing entries that the window covers into the buckets
+	inline void TakeOverflow()
+	{
+		while (!overflow_.empty() && GetKey(overflow_.front().first) - current_ < buckets_.size())
+		{
+			std::pop_heap(overflow_.begin(), overflow_.end(), std::greater<BucketElement>());
+			PutInBucket(GetKey(overflow_.back().first), overflow_.back());
+			overflow_.pop_back();
+		}
+	}
+
+	// enlarge the circular array so that it covers at least span keys from current_
+	void Grow(uint64_t span)
+	{
+		std::size_t capacity = buckets_.size();
+		while (capacity < span)
+			capacity <<= 1;
+
+		std::vector<std::vector<BucketElement>> buckets(capacity);
+		const uint64_t old_mask = buckets_.size() - 1;
+		for (uint64_t key = current_; key < current_ + buckets_.size(); ++key)
+			buckets[key & (capacity - 1)].swap(buckets_[key & old_mask]);
+		buckets_.swap(buckets);
+		TakeOverflow();
+	}
+};
+
+template <typename Number>
+constexpr std::size_t BucketQueue<Number>::MaxBucketNum;
+}
+
+#endif /* BUCKET_QUEUE_HPP */
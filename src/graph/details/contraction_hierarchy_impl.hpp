@@ -0,0 +1,446 @@
+/*
+ * contraction_hierarchy_impl.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef CONTRACTION_HIERARCHY_IMPL_HPP
+#define CONTRACTION_HIERARCHY_IMPL_HPP
+
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "graph/details/priority_queue.hpp"
+
+namespace librav
+{
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+constexpr uint32_t ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::InvalidIndex;
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+constexpr std::size_t ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::WitnessSettleLimit;
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::ContractionHierarchy_t(const Graph_t<StateType, TransitionType, IDIndexType> &graph, std::size_t thread_num) : graph_(&graph)
+{
+	const std::size_t vertex_num = graph.GetVertexIndexBound();
+
+	out_edges_.resize(vertex_num);
+	in_edges_.resize(vertex_num);
+	for (auto &vtx : graph.GetGraphVertices())
+	{
+		for (const auto &edge : vtx->edges_to_)
+		{
+			// self loops are never part of a shortest path
+			if (edge.dst_ != vtx)
+				AddHierarchyEdge(vtx->vertex_index_, edge.dst_->vertex_index_, edge.cost_, InvalidIndex);
+		}
+	}
+
+	Contract(thread_num == 0 ? 1 : thread_num);
+
+	// the adjacency of the remaining graph is empty after contraction
+	out_edges_.clear();
+	out_edges_.shrink_to_fit();
+	in_edges_.clear();
+	in_edges_.shrink_to_fit();
+}
+
+/// Add an edge to the remaining graph, or lower the cost of the edge if it exists already
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::AddHierarchyEdge(uint32_t src, uint32_t dst, TransitionType cost, uint32_t middle)
+{
+	for (auto &edge : out_edges_[src])
+	{
+		if (edge.vertex_ == dst)
+		{
+			if (cost < edge.cost_)
+			{
+				edge.cost_ = cost;
+				edge.middle_ = middle;
+				for (auto &in_edge : in_edges_[dst])
+				{
+					if (in_edge.vertex_ == src)
+					{
+						in_edge.cost_ = cost;
+						in_edge.middle_ = middle;
+						break;
+					}
+				}
+			}
+			return;
+		}
+	}
+
+	out_edges_[src].push_back(HierarchyEdge{dst, cost, middle});
+	in_edges_[dst].push_back(HierarchyEdge{src, cost, middle});
+}
+
+/// Local Dijkstra search from source in the remaining graph that doesn't pass the
+///	excluded vertex, it stops at max_cost or after WitnessSettleLimit vertices
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::WitnessSearch(SearchContext &context, uint32_t source, uint32_t excluded, double max_cost) const
+{
+	context.Reset(out_edges_.size());
+
+	PriorityQueue<uint32_t> openlist;
+	SearchInfo &source_info = context.GetSearchInfo(source);
+	source_info.is_in_openlist_ = true;
+	openlist.put(source, 0);
+
+	std::size_t settled_num = 0;
+	while (!openlist.empty() && settled_num < WitnessSettleLimit)
+	{
+		uint32_t current = openlist.get();
+		SearchInfo &current_info = context.GetSearchInfo(current);
+		if (current_info.is_checked_)
+			continue;
+		if (current_info.g_astar_ > max_cost)
+			break;
+
+		current_info.is_checked_ = true;
+		++settled_num;
+
+		for (const auto &edge : out_edges_[current])
+		{
+			if (edge.vertex_ == excluded)
+				continue;
+
+			SearchInfo &neighbour_info = context.GetSearchInfo(edge.vertex_);
+			double new_cost = current_info.g_astar_ + edge.cost_;
+			if (!neighbour_info.is_checked_ && (!neighbour_info.is_in_openlist_ || new_cost < neighbour_info.g_astar_))
+			{
+				neighbour_info.g_astar_ = new_cost;
+				neighbour_info.is_in_openlist_ = true;
+				openlist.put(edge.vertex_, new_cost);
+			}
+		}
+	}
+}
+
+/// Collect the shortcuts needed to contract a vertex from the remaining graph
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::FindShortcuts(SearchContext &context, uint32_t vertex, std::vector<Shortcut> &shortcuts) const
+{
+	shortcuts.clear();
+	if (out_edges_[vertex].empty())
+		return;
+
+	double max_out_cost = 0;
+	for (const auto &out_edge : out_edges_[vertex])
+		max_out_cost = std::max(max_out_cost, static_cast<double>(out_edge.cost_));
+
+	for (const auto &in_edge : in_edges_[vertex])
+	{
+		WitnessSearch(context, in_edge.vertex_, vertex, in_edge.cost_ + max_out_cost);
+
+		for (const auto &out_edge : out_edges_[vertex])
+		{
+			if (out_edge.vertex_ == in_edge.vertex_)
+				continue;
+
+			// the path through the vertex is needed unless a witness is at most as long
+			TransitionType cost = in_edge.cost_ + out_edge.cost_;
+			if (!context.IsVisited(out_edge.vertex_) || context.GetSearchInfo(out_edge.vertex_).g_astar_ > cost)
+				shortcuts.push_back(Shortcut{in_edge.vertex_, out_edge.vertex_, cost});
+		}
+	}
+}
+
+/// Contract all vertices in the order of their priority
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::Contract(std::size_t thread_num)
+{
+	const std::size_t vertex_num = out_edges_.size();
+	std::vector<int64_t> contracted_neighbours(vertex_num, 0);
+	std::vector<uint32_t> vertices;
+	for (uint32_t i = 0; i < vertex_num; ++i)
+	{
+		if (graph_->GetVertexFromIndex(i) != nullptr)
+			vertices.push_back(i);
+	}
+
+	auto calc_priority = [this, &contracted_neighbours](SearchContext &context, std::vector<Shortcut> &shortcuts, uint32_t vertex) {
+		FindShortcuts(context, vertex, shortcuts);
+		return static_cast<int64_t>(shortcuts.size()) - static_cast<int64_t>(out_edges_[vertex].size() + in_edges_[vertex].size()) + contracted_neighbours[vertex];
+	};
+
+	// the initial priorities are independent of each other and computed in parallel, the
+	//	calling thread takes the first share
+	std::vector<int64_t> priorities(vertex_num, 0);
+	auto calc_share = [&](std::size_t t) {
+		SearchContext context;
+		std::vector<Shortcut> shortcuts;
+		for (std::size_t i = t; i < vertices.size(); i += thread_num)
+			priorities[vertices[i]] = calc_priority(context, shortcuts, vertices[i]);
+	};
+	std::vector<std::thread> workers;
+	std::size_t started_num = 1;
+	try
+	{
+		workers.reserve(thread_num - 1);
+		for (; started_num < thread_num; ++started_num)
+			workers.emplace_back(calc_share, started_num);
+	}
+	catch (...)
+	{
+		// the shares of the threads that couldn't be started are computed here
+	}
+	calc_share(0);
+	for (std::size_t t = started_num; t < thread_num; ++t)
+		calc_share(t);
+	for (auto &worker : workers)
+		worker.join();
+
+	typedef std::pair<int64_t, uint32_t> QueueElement;
+	std::priority_queue<QueueElement, std::vector<QueueElement>, std::greater<QueueElement>> queue;
+	for (auto vertex : vertices)
+		queue.emplace(priorities[vertex], vertex);
+
+	rank_.assign(vertex_num, InvalidIndex);
+	std::vector<std::vector<HierarchyEdge>> upward(vertex_num);
+	std::vector<std::vector<HierarchyEdge>> downward(vertex_num);
+
+	SearchContext context;
+	std::vector<Shortcut> shortcuts;
+	std::vector<Shortcut> neighbour_shortcuts;
+	std::vector<uint32_t> neighbours;
+	uint32_t next_rank = 0;
+	while (!queue.empty())
+	{
+		int64_t queued_priority = queue.top().first;
+		uint32_t vertex = queue.top().second;
+		queue.pop();
+
+		// skip outdated queue entries
+		if (rank_[vertex] != InvalidIndex || queued_priority != priorities[vertex])
+			continue;
+
+		// lazy update: the priority may have changed since it was computed
+		priorities[vertex] = calc_priority(context, shortcuts, vertex);
+		if (!queue.empty() && priorities[vertex] > queue.top().first)
+		{
+			queue.emplace(priorities[vertex], vertex);
+			continue;
+		}
+
+		// the remaining neighbours are contracted later and rank higher
+		rank_[vertex] = next_rank++;
+		upward[vertex] = out_edges_[vertex];
+		downward[vertex] = in_edges_[vertex];
+
+		for (const auto &shortcut : shortcuts)
+			AddHierarchyEdge(shortcut.src_, shortcut.dst_, shortcut.cost_, vertex);
+		shortcut_num_ += shortcuts.size();
+
+		// remove the vertex from the remaining graph
+		for (const auto &edge : out_edges_[vertex])
+		{
+			auto &list = in_edges_[edge.vertex_];
+			list.erase(std::remove_if(list.begin(), list.end(), [vertex](const HierarchyEdge &e) { return e.vertex_ == vertex; }), list.end());
+			++contracted_neighbours[edge.vertex_];
+		}
+		for (const auto &edge : in_edges_[vertex])
+		{
+			auto &list = out_edges_[edge.vertex_];
+			list.erase(std::remove_if(list.begin(), list.end(), [vertex](const HierarchyEdge &e) { return e.vertex_ == vertex; }), list.end());
+			++contracted_neighbours[edge.vertex_];
+		}
+
+		// update the priorities of the neighbours, they are affected the most by the contraction
+		neighbours.clear();
+		for (const auto &edge : out_edges_[vertex])
+			neighbours.push_back(edge.vertex_);
+		for (const auto &edge : in_edges_[vertex])
+			neighbours.push_back(edge.vertex_);
+		out_edges_[vertex].clear();
+		in_edges_[vertex].clear();
+
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+		for (auto neighbour : neighbours)
+		{
+			priorities[neighbour] = calc_priority(context, neighbour_shortcuts, neighbour);
+			queue.emplace(priorities[neighbour], neighbour);
+		}
+	}
+
+	// store the upward and downward edges in CSR layout
+	upward_offsets_.assign(vertex_num + 1, 0);
+	downward_offsets_.assign(vertex_num + 1, 0);
+	for (std::size_t i = 0; i < vertex_num; ++i)
+	{
+		upward_offsets_[i + 1] = upward_offsets_[i] + static_cast<uint32_t>(upward[i].size());
+		downward_offsets_[i + 1] = downward_offsets_[i] + static_cast<uint32_t>(downward[i].size());
+	}
+	upward_edges_.reserve(upward_offsets_.back());
+	downward_edges_.reserve(downward_offsets_.back());
+	for (std::size_t i = 0; i < vertex_num; ++i)
+	{
+		upward_edges_.insert(upward_edges_.end(), upward[i].begin(), upward[i].end());
+		downward_edges_.insert(downward_edges_.end(), downward[i].begin(), downward[i].end());
+	}
+}
+
+/// Run a bidirectional upward search between two vertex indices
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::Query(BidirectionalSearchContext &context, uint32_t start_idx, uint32_t goal_idx) const
+{
+	context.forward_.Reset(rank_.size());
+	context.backward_.Reset(rank_.size());
+
+	PriorityQueue<uint32_t> forward_openlist;
+	PriorityQueue<uint32_t> backward_openlist;
+
+	context.forward_.GetSearchInfo(start_idx).search_parent_ = start_idx;
+	context.forward_.GetSearchInfo(start_idx).is_in_openlist_ = true;
+	forward_openlist.put(start_idx, 0);
+	context.backward_.GetSearchInfo(goal_idx).search_parent_ = goal_idx;
+	context.backward_.GetSearchInfo(goal_idx).is_in_openlist_ = true;
+	backward_openlist.put(goal_idx, 0);
+
+	double best_cost = std::numeric_limits<double>::infinity();
+	if (start_idx == goal_idx)
+	{
+		best_cost = 0;
+		context.meeting_vertex_ = start_idx;
+	}
+
+	// the searches only move upwards so neither can stop when they first meet, each
+	//	direction runs until its smallest key exceeds the best path found
+	bool forward = true;
+	while (!forward_openlist.empty() || !backward_openlist.empty())
+	{
+		if (forward_openlist.empty())
+			forward = false;
+		else if (backward_openlist.empty())
+			forward = true;
+
+		PriorityQueue<uint32_t> &openlist = forward ? forward_openlist : backward_openlist;
+		SearchContext &this_side = forward ? context.forward_ : context.backward_;
+		SearchContext &other_side = forward ? context.backward_ : context.forward_;
+		const std::vector<uint32_t> &offsets = forward ? upward_offsets_ : downward_offsets_;
+		const std::vector<HierarchyEdge> &edges = forward ? upward_edges_ : downward_edges_;
+		forward = !forward;
+
+		uint32_t current = openlist.get();
+		SearchInfo &current_info = this_side.GetSearchInfo(current);
+		if (current_info.is_checked_)
+			continue;
+		if (current_info.g_astar_ >= best_cost)
+		{
+			openlist = PriorityQueue<uint32_t>();
+			continue;
+		}
+		current_info.is_checked_ = true;
+
+		for (uint32_t e = offsets[current]; e < offsets[current + 1]; ++e)
+		{
+			const HierarchyEdge &edge = edges[e];
+			SearchInfo &neighbour_info = this_side.GetSearchInfo(edge.vertex_);
+			double new_cost = current_info.g_astar_ + edge.cost_;
+			if (neighbour_info.is_checked_ || (neighbour_info.is_in_openlist_ && new_cost >= neighbour_info.g_astar_))
+				continue;
+
+			neighbour_info.search_parent_ = current;
+			neighbour_info.g_astar_ = new_cost;
+			neighbour_info.is_in_openlist_ = true;
+			openlist.put(edge.vertex_, new_cost);
+
+			if (other_side.IsVisited(edge.vertex_) && new_cost + other_side.GetSearchInfo(edge.vertex_).g_astar_ < best_cost)
+			{
+				best_cost = new_cost + other_side.GetSearchInfo(edge.vertex_).g_astar_;
+				context.meeting_vertex_ = edge.vertex_;
+			}
+		}
+	}
+
+	context.path_cost_ = best_cost;
+	return best_cost < std::numeric_limits<double>::infinity();
+}
+
+/// Find the hierarchy edge from src to dst, one of them is contracted before the other
+template <typename StateType, typename TransitionType, typename IDIndexType>
+const typename ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::HierarchyEdge *ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::FindEdge(uint32_t src, uint32_t dst) const
+{
+	if (rank_[src] < rank_[dst])
+	{
+		for (uint32_t e = upward_offsets_[src]; e < upward_offsets_[src + 1]; ++e)
+			if (upward_edges_[e].vertex_ == dst)
+				return &upward_edges_[e];
+	}
+	else
+	{
+		for (uint32_t e = downward_offsets_[dst]; e < downward_offsets_[dst + 1]; ++e)
+			if (downward_edges_[e].vertex_ == src)
+				return &downward_edges_[e];
+	}
+	return nullptr;
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::vector<uint32_t> ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::UnpackPath(const BidirectionalSearchContext &context, uint32_t start_idx, uint32_t goal_idx) const
+{
+	std::vector<uint32_t> packed_path = context.ReconstructPath(start_idx, goal_idx);
+
+	std::vector<uint32_t> path;
+	path.push_back(start_idx);
+
+	// replace each shortcut by the two edges it bypasses until only original edges are left
+	std::vector<std::pair<uint32_t, uint32_t>> edge_stack;
+	for (std::size_t i = packed_path.size() - 1; i > 0; --i)
+		edge_stack.emplace_back(packed_path[i - 1], packed_path[i]);
+	while (!edge_stack.empty())
+	{
+		auto edge = edge_stack.back();
+		edge_stack.pop_back();
+
+		uint32_t middle = FindEdge(edge.first, edge.second)->middle_;
+		if (middle == InvalidIndex)
+		{
+			path.push_back(edge.second);
+		}
+		else
+		{
+			edge_stack.emplace_back(middle, edge.second);
+			edge_stack.emplace_back(edge.first, middle);
+		}
+	}
+
+	return path;
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Path_t<StateType, TransitionType> ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::Search(uint64_t start_id, uint64_t goal_id) const
+{
+	// reuse a per-thread context so that preparing a new search is O(1)
+	static thread_local BidirectionalSearchContext context;
+
+	return Search(context, start_id, goal_id);
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Path_t<StateType, TransitionType> ContractionHierarchy_t<StateType, TransitionType, IDIndexType>::Search(BidirectionalSearchContext &context, uint64_t start_id, uint64_t goal_id) const
+{
+	auto start = graph_->GetVertexFromID(start_id);
+	auto goal = graph_->GetVertexFromID(goal_id);
+
+	Path_t<StateType, TransitionType> path;
+
+	if (start != nullptr && goal != nullptr && Query(context, start->vertex_index_, goal->vertex_index_))
+	{
+		for (auto &waypoint : UnpackPath(context, start->vertex_index_, goal->vertex_index_))
+			path.push_back(graph_->GetVertexFromIndex(waypoint));
+	}
+
+	return path;
+}
+}
+
+#endif /* CONTRACTION_HIERARCHY_IMPL_HPP */
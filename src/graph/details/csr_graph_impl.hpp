@@ -0,0 +1,100 @@
+/*
+ * csr_graph_impl.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef CSR_GRAPH_IMPL_HPP
+#define CSR_GRAPH_IMPL_HPP
+
+namespace librav
+{
+
+/****************************************************************************/
+/*								 CsrGraph_t									*/
+/****************************************************************************/
+template <typename StateType, typename TransitionType>
+constexpr uint32_t CsrGraph_t<StateType, TransitionType>::InvalidIndex;
+
+template <typename StateType, typename TransitionType>
+template <typename IDIndexType>
+CsrGraph_t<StateType, TransitionType>::CsrGraph_t(const Graph_t<StateType, TransitionType, IDIndexType> &graph)
+{
+	auto vertices = graph.GetGraphVertices();
+
+	// assign dense indices
+	vertex_ids_.reserve(vertices.size());
+	states_.reserve(vertices.size());
+	id_index_map_.reserve(vertices.size());
+	std::size_t edge_num = 0;
+	for (auto &vtx : vertices)
+	{
+		id_index_map_.insert(std::make_pair(vtx->vertex_id_, static_cast<uint32_t>(vertex_ids_.size())));
+		vertex_ids_.push_back(vtx->vertex_id_);
+		states_.push_back(vtx->state_);
+		edge_num += vtx->edges_to_.size();
+	}
+
+	// fill the edge arrays, edges of a vertex are kept in insertion order
+	offsets_.reserve(vertices.size() + 1);
+	edge_dst_.reserve(edge_num);
+	edge_cost_.reserve(edge_num);
+	offsets_.push_back(0);
+	for (auto &vtx : vertices)
+	{
+		for (const auto &edge : vtx->edges_to_)
+		{
+			edge_dst_.push_back(id_index_map_[edge.dst_->vertex_id_]);
+			edge_cost_.push_back(edge.cost_);
+		}
+		offsets_.push_back(static_cast<uint32_t>(edge_dst_.size()));
+	}
+
+	// group the edges by destination with a counting sort
+	reverse_offsets_.assign(vertices.size() + 1, 0);
+	for (auto dst : edge_dst_)
+		++reverse_offsets_[dst + 1];
+	for (std::size_t i = 1; i < reverse_offsets_.size(); ++i)
+		reverse_offsets_[i] += reverse_offsets_[i - 1];
+
+	std::vector<uint32_t> fill_pos(reverse_offsets_.begin(), reverse_offsets_.end() - 1);
+	reverse_edge_src_.resize(edge_num);
+	reverse_edge_cost_.resize(edge_num);
+	for (uint32_t src = 0; src < vertices.size(); ++src)
+	{
+		for (uint32_t e = offsets_[src]; e < offsets_[src + 1]; ++e)
+		{
+			uint32_t pos = fill_pos[edge_dst_[e]]++;
+			reverse_edge_src_[pos] = src;
+			reverse_edge_cost_[pos] = edge_cost_[e];
+		}
+	}
+}
+
+/// Get the dense index of the vertex with specified id, InvalidIndex is returned if not found
+template <typename StateType, typename TransitionType>
+uint32_t CsrGraph_t<StateType, TransitionType>::GetVertexIndex(uint64_t vertex_id) const
+{
+	auto it = id_index_map_.find(vertex_id);
+
+	if (it != id_index_map_.end())
+		return it->second;
+	else
+		return InvalidIndex;
+}
+
+/****************************************************************************/
+/*								 Graph_t									*/
+/****************************************************************************/
+/// This function creates an immutable CSR snapshot of the graph
+template <typename StateType, typename TransitionType, typename IDIndexType>
+CsrGraph_t<StateType, TransitionType> Graph_t<StateType, TransitionType, IDIndexType>::Freeze() const
+{
+	return CsrGraph_t<StateType, TransitionType>(*this);
+}
+}
+
+#endif /* CSR_GRAPH_IMPL_HPP */
@@ -0,0 +1,179 @@
+/*
+ * graph_arena.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: slab allocator for the vertices and edge lists of a graph
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef GRAPH_ARENA_HPP
+#define GRAPH_ARENA_HPP
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+
+namespace librav
+{
+
+/// Memory owned by a graph. Blocks are carved from large chunks and sorted into size classes:
+///	multiples of 16 bytes up to 512 bytes and powers of two above. A freed block is put on the
+///	free list of its class and handed out again by the next allocation of the same class.
+///
+/// The chunks are only returned to the system by Release() or when the arena is destroyed, so
+///	releasing a whole graph doesn't free its vertices and edge lists one by one. Blocks are
+///	aligned to 16 bytes.
+class GraphArena
+{
+  public:
+	static constexpr std::size_t Alignment = 16;
+
+	GraphArena() = default;
+	~GraphArena() { Release(); }
+
+	GraphArena(const GraphArena &) = delete;
+	GraphArena &operator=(const GraphArena &) = delete;
+
+	/// Get a block of at least size bytes
+	void *Allocate(std::size_t size)
+	{
+		std::size_t size_class = GetSizeClass(size);
+		FreeBlock *block = free_lists_[size_class];
+		if (block != nullptr)
+		{
+			free_lists_[size_class] = block->next_;
+			return block;
+		}
+		return Carve(GetBlockSize(size_class));
+	}
+
+	/// Return a block, size must be the size it was allocated with
+	void Deallocate(void *ptr, std::size_t size)
+	{
+		std::size_t size_class = GetSizeClass(size);
+		FreeBlock *block = static_cast<FreeBlock *>(ptr);
+		block->next_ = free_lists_[size_class];
+		free_lists_[size_class] = block;
+	}
+
+	/// Return all chunks to the system, all blocks become invalid
+	void Release()
+	{
+		for (auto chunk : chunks_)
+			::operator delete(chunk);
+		chunks_.clear();
+		free_lists_.fill(nullptr);
+		cursor_ = nullptr;
+		end_ = nullptr;
+		reserved_size_ = 0;
+	}
+
+	/// Number of bytes allocated from the system
+	std::size_t GetReservedSize() const { return reserved_size_; }
+
+  private:
+	static constexpr std::size_t ChunkSize = std::size_t(1) << 20;
+	static constexpr std::size_t SmallBlockLimit = 512;
+	static constexpr std::size_t SmallClassNum = SmallBlockLimit / Alignment;
+
+	struct FreeBlock
+	{
+		FreeBlock *next_;
+	};
+
+	std::vector<void *> chunks_;
+	std::array<FreeBlock *, SmallClassNum + 64> free_lists_ = {};
+	char *cursor_ = nullptr;
+	char *end_ = nullptr;
+	std::size_t reserved_size_ = 0;
+
+	static std::size_t GetSizeClass(std::size_t size)
+	{
+		if (size <= SmallBlockLimit)
+			return (size == 0) ? 0 : (size - 1) / Alignment;
+
+		std::size_t size_class = SmallClassNum;
+		for (std::size_t block_size = SmallBlockLimit * 2; block_size < size; block_size *= 2)
+			++size_class;
+		return size_class;
+	}
+
+	static std::size_t GetBlockSize(std::size_t size_class)
+	{
+		if (size_class < SmallClassNum)
+			return (size_class + 1) * Alignment;
+		return SmallBlockLimit << (size_class - SmallClassNum + 1);
+	}
+
+	void *Carve(std::size_t block_size)
+	{
+		// large blocks get a chunk of their own, the current chunk is kept
+		if (block_size > ChunkSize / 4)
+			return AllocateChunk(block_size);
+
+		if (cursor_ == nullptr || static_cast<std::size_t>(end_ - cursor_) < block_size)
+		{
+			cursor_ = static_cast<char *>(AllocateChunk(ChunkSize));
+			end_ = cursor_ + ChunkSize;
+		}
+
+		void *block = cursor_;
+		cursor_ += block_size;
+		return block;
+	}
+
+	void *AllocateChunk(std::size_t size)
+	{
+		void *chunk = ::operator new(size);
+		chunks_.push_back(chunk);
+		reserved_size_ += size;
+		return chunk;
+	}
+};
+
+/// Standard allocator that takes its memory from a GraphArena, or from the global heap if no
+///	arena is given. It's used for the edge lists of Vertex_t.
+template <typename T>
+class ArenaAllocator
+{
+  public:
+	typedef T value_type;
+
+	ArenaAllocator() = default;
+	explicit ArenaAllocator(GraphArena *arena) : arena_(arena) {}
+
+	template <typename U>
+	ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.GetArena()) {}
+
+	T *allocate(std::size_t n)
+	{
+		if (arena_ == nullptr)
+			return static_cast<T *>(::operator new(n * sizeof(T)));
+		return static_cast<T *>(arena_->Allocate(n * sizeof(T)));
+	}
+
+	void deallocate(T *ptr, std::size_t n)
+	{
+		if (arena_ == nullptr)
+			::operator delete(ptr);
+		else
+			arena_->Deallocate(ptr, n * sizeof(T));
+	}
+
+	GraphArena *GetArena() const { return arena_; }
+
+	template <typename U>
+	bool operator==(const ArenaAllocator<U> &other) const { return arena_ == other.GetArena(); }
+
+	template <typename U>
+	bool operator!=(const ArenaAllocator<U> &other) const { return arena_ != other.GetArena(); }
+
+  private:
+	GraphArena *arena_ = nullptr;
+};
+}
+
+#endif /* GRAPH_ARENA_HPP */
@@ -0,0 +1,96 @@
+/*
+ * graph_builder_impl.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef GRAPH_BUILDER_IMPL_HPP
+#define GRAPH_BUILDER_IMPL_HPP
+
+#include <tuple>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+
+namespace librav
+{
+
+template <typename StateType, typename TransitionType, typename IDIndexType, typename GetNeighbourFunc>
+std::size_t AddGeneratedEdges(Graph_t<StateType, TransitionType, IDIndexType> &graph, const std::vector<StateType> &states, GetNeighbourFunc &&get_neighbours, std::size_t thread_num)
+{
+	// states are handed out in chunks, generators with uneven cost per state are balanced
+	//	without contending on the counter for every state
+	const std::size_t chunk_size = 64;
+	thread_num = std::max<std::size_t>(1, std::min(thread_num, (states.size() + chunk_size - 1) / chunk_size));
+
+	std::vector<std::vector<std::tuple<StateType, TransitionType>>> neighbours(states.size());
+	std::atomic<std::size_t> next_chunk(0);
+	std::vector<std::exception_ptr> errors(thread_num);
+
+	auto generate = [&](std::size_t t) {
+		try
+		{
+			for (std::size_t begin = next_chunk.fetch_add(chunk_size); begin < states.size(); begin = next_chunk.fetch_add(chunk_size))
+			{
+				for (std::size_t i = begin; i < std::min(begin + chunk_size, states.size()); ++i)
+					neighbours[i] = get_neighbours(states[i]);
+			}
+		}
+		catch (...)
+		{
+			errors[t] = std::current_exception();
+			// let the other threads run out of states
+			next_chunk = states.size();
+		}
+	};
+
+	// the calling thread works as well. If a thread can't be started, the ones running
+	//	are stopped and joined before the error is passed on.
+	std::vector<std::thread> workers;
+	workers.reserve(thread_num - 1);
+	try
+	{
+		for (std::size_t t = 1; t < thread_num; ++t)
+			workers.emplace_back(generate, t);
+	}
+	catch (...)
+	{
+		next_chunk = states.size();
+		for (auto &worker : workers)
+			worker.join();
+		throw;
+	}
+	generate(0);
+	for (auto &worker : workers)
+		worker.join();
+
+	for (auto &error : errors)
+	{
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+	// merge the results in the order of the states
+	std::size_t edge_num = 0;
+	for (const auto &successors : neighbours)
+		edge_num += successors.size();
+
+	std::vector<std::tuple<StateType, StateType, TransitionType>> edges;
+	edges.reserve(edge_num);
+	for (std::size_t i = 0; i < states.size(); ++i)
+	{
+		for (const auto &successor : neighbours[i])
+			edges.emplace_back(states[i], std::get<0>(successor), std::get<1>(successor));
+		// the successors are copied, free them as we go to keep the peak memory low
+		std::vector<std::tuple<StateType, TransitionType>>().swap(neighbours[i]);
+	}
+
+	graph.Reserve(graph.GetVertexNumber() + states.size(), edge_num);
+	return graph.AddEdges(edges);
+}
+}
+
+#endif /* GRAPH_BUILDER_IMPL_HPP */
@@ -10,226 +10,543 @@
 #ifndef GRAPH_IMPL_HPP
 #define GRAPH_IMPL_HPP
 
+#include <cstdint>
+#include <tuple>
+#include <algorithm>
+
 namespace librav
 {
 
 /****************************************************************************/
 /*								 Graph_t									*/
 /****************************************************************************/
-template <typename StateType, typename TransitionType>
-Graph_t<StateType, TransitionType>::~Graph_t()
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Graph_t<StateType, TransitionType, IDIndexType>::~Graph_t()
 {
-	for (auto &vertex_pair : vertex_map_)
-		delete vertex_pair.second;
-};
-
-/// This function is used to reset the vertices for a new search
-template <typename StateType, typename TransitionType>
-void Graph_t<StateType, TransitionType>::ResetGraphVertices()
-{
-	for (auto &vertex_pair : vertex_map_)
-		vertex_pair.second->ClearVertexSearchInfo();
+	ReleaseVertices();
 };
 
 /// This function removes all edges and vertices in the graph
-template <typename StateType, typename TransitionType>
-void Graph_t<StateType, TransitionType>::ClearGraph()
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::ClearGraph()
 {
-	for (auto &vertex_pair : vertex_map_)
-		delete vertex_pair.second;
+	ReleaseVertices();
 	vertex_map_.clear();
+	vertex_table_.clear();
+	free_indices_.clear();
+	edge_index_.clear();
+	edge_index_built_ = false;
+}
+
+/// This function destroys all vertices and returns their memory in bulk
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::ReleaseVertices()
+{
+	// the edge lists live in the arena as well, so the destructors only need to run for states
+	//	that own resources
+	if (!std::is_trivially_destructible<StateType>::value)
+	{
+		for (auto vertex : vertex_table_)
+		{
+			if (vertex != nullptr)
+				vertex->~VertexType();
+		}
+	}
+	arena_.Release();
+}
+
+/// This function constructs a vertex in memory taken from the arena
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::CreateVertex(StateType vertex_node)
+{
+	return new (arena_.Allocate(sizeof(VertexType))) VertexType(vertex_node, &arena_);
+}
+
+/// This function creates a vertex and adds it to the id index and the vertex table
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::InsertVertex(StateType vertex_node)
+{
+	VertexType *new_vertex = CreateVertex(vertex_node);
+	bool inserted = false;
+	try
+	{
+		inserted = vertex_map_.insert(new_vertex->vertex_id_, new_vertex).second;
+		AssignVertexIndex(new_vertex);
+	}
+	catch (...)
+	{
+		// e.g. DenseIDIndex rejects ids above DenseIDMap::MaxID, the graph is left as it was
+		if (inserted)
+			vertex_map_.erase(new_vertex->vertex_id_);
+		DestroyVertex(new_vertex);
+		throw;
+	}
+	return new_vertex;
+}
+
+/// This function destroys a vertex, its memory is reused by the next vertex created
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::DestroyVertex(VertexType *vertex)
+{
+	vertex->~VertexType();
+	arena_.Deallocate(vertex, sizeof(VertexType));
 }
 
 /// This function return the vertex with specified id
-template <typename StateType, typename TransitionType>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::GetVertexFromID(uint64_t vertex_id)
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::GetVertexFromID(uint64_t vertex_id) const
 {
-	auto it = vertex_map_.find(vertex_id);
+	auto vertex = vertex_map_.find(vertex_id);
 
-	if (it != vertex_map_.end())
-		return (*it).second;
+	if (vertex != nullptr)
+		return *vertex;
 	else
 		return nullptr;
 };
 
+/// This function return the vertex with specified dense index
+template <typename StateType, typename TransitionType, typename IDIndexType>
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::GetVertexFromIndex(uint32_t vertex_index) const
+{
+	if (vertex_index < vertex_table_.size())
+		return vertex_table_[vertex_index];
+	else
+		return nullptr;
+};
+
+/// This function assigns a dense index to a newly created vertex
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::AssignVertexIndex(VertexType *vertex)
+{
+	if (!free_indices_.empty())
+	{
+		vertex->vertex_index_ = free_indices_.back();
+		free_indices_.pop_back();
+		vertex_table_[vertex->vertex_index_] = vertex;
+	}
+	else
+	{
+		vertex->vertex_index_ = static_cast<uint32_t>(vertex_table_.size());
+		vertex_table_.push_back(vertex);
+	}
+}
+
+/// This function builds the edge index from the current edge lists
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::BuildEdgeIndex()
+{
+	std::size_t edge_num = 0;
+	for (auto vertex : vertex_table_)
+	{
+		if (vertex != nullptr)
+			edge_num += vertex->edges_to_.size();
+	}
+	edge_index_.clear();
+	edge_index_.reserve(edge_num);
+
+	for (auto vertex : vertex_table_)
+	{
+		if (vertex == nullptr)
+			continue;
+		for (uint32_t i = 0; i < vertex->edges_to_.size(); ++i)
+			edge_index_.insert(GetEdgeKey(vertex, vertex->edges_to_[i].dst_), EdgeSlot{i, 0});
+	}
+	for (auto vertex : vertex_table_)
+	{
+		if (vertex == nullptr)
+			continue;
+		for (uint32_t i = 0; i < vertex->edges_from_.size(); ++i)
+			edge_index_.find(GetEdgeKey(vertex->edges_from_[i].src_, vertex))->from_pos_ = i;
+	}
+
+	edge_index_built_ = true;
+}
+
+/// This function updates both copies of the edge from src to dst
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool Graph_t<StateType, TransitionType, IDIndexType>::SetEdgeCost(VertexType *src, VertexType *dst, TransitionType cost)
+{
+	if (!edge_index_built_)
+		BuildEdgeIndex();
+
+	EdgeSlot *slot = edge_index_.find(GetEdgeKey(src, dst));
+	if (slot == nullptr)
+		return false;
+
+	src->edges_to_[slot->to_pos_].cost_ = cost;
+	dst->edges_from_[slot->from_pos_].cost_ = cost;
+
+	return true;
+}
+
+/// This function removes the edge from src to dst. The last edge of each list is moved
+///	into the freed slot, so the order of the remaining edges may change.
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool Graph_t<StateType, TransitionType, IDIndexType>::EraseEdge(VertexType *src, VertexType *dst)
+{
+	if (!edge_index_built_)
+		BuildEdgeIndex();
+
+	EdgeSlot *found = edge_index_.find(GetEdgeKey(src, dst));
+	if (found == nullptr)
+		return false;
+
+	EdgeSlot slot = *found;
+	edge_index_.erase(GetEdgeKey(src, dst));
+
+	auto &to = src->edges_to_;
+	if (slot.to_pos_ + 1 != to.size())
+	{
+		to[slot.to_pos_] = to.back();
+		edge_index_.find(GetEdgeKey(src, to[slot.to_pos_].dst_))->to_pos_ = slot.to_pos_;
+	}
+	to.pop_back();
+
+	auto &from = dst->edges_from_;
+	if (slot.from_pos_ + 1 != from.size())
+	{
+		from[slot.from_pos_] = from.back();
+		edge_index_.find(GetEdgeKey(from[slot.from_pos_].src_, dst))->from_pos_ = slot.from_pos_;
+	}
+	from.pop_back();
+
+	return true;
+}
+
 /// This function is used to create a graph by adding edges connecting two nodes
-template <typename StateType, typename TransitionType>
-void Graph_t<StateType, TransitionType>::AddEdge(StateType src_node, StateType dst_node, TransitionType cost)
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::AddEdge(StateType src_node, StateType dst_node, TransitionType cost)
 {
 	Vertex_t<StateType, TransitionType> *src_vertex = GetVertex(src_node);
 	Vertex_t<StateType, TransitionType> *dst_vertex = GetVertex(dst_node);
 
-	if (src_vertex->CheckNeighbour(dst_vertex))
-		return;
-
-	// store information for deleting vertex
-	dst_vertex->vertices_from_.push_back(src_vertex);
-	
-	src_vertex->edges_to_.emplace_back(src_vertex, dst_vertex, cost);
+	InsertEdge(src_vertex, dst_vertex, cost);
 };
 
-/// This function is used to remove the edge from src_node to dst_node.
-template <typename StateType, typename TransitionType>
-bool Graph_t<StateType, TransitionType>::RemoveEdge(StateType src_node, StateType dst_node)
+/// This function adds the edge from src to dst unless it already exists
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool Graph_t<StateType, TransitionType, IDIndexType>::InsertEdge(VertexType *src, VertexType *dst, TransitionType cost)
 {
-	Vertex_t<StateType, TransitionType> *src_vertex = SearchVertex(src_node);
-	Vertex_t<StateType, TransitionType> *dst_vertex = SearchVertex(dst_node);
+	if (edge_index_built_)
+	{
+		EdgeSlot slot{static_cast<uint32_t>(src->edges_to_.size()), static_cast<uint32_t>(dst->edges_from_.size())};
+		if (!edge_index_.insert(GetEdgeKey(src, dst), slot).second)
+			return false;
+	}
+	else if (src->CheckNeighbour(dst))
+		return false;
 
-	if ((src_vertex != nullptr) && (dst_vertex != nullptr))
+	// store reverse edge for backward search and deleting vertex
+	dst->edges_from_.emplace_back(src, cost);
+
+	src->edges_to_.emplace_back(dst, cost);
+
+	return true;
+}
+
+/// This function adds a batch of edges, duplicates are skipped.
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::size_t Graph_t<StateType, TransitionType, IDIndexType>::AddEdges(const std::vector<std::tuple<StateType, StateType, TransitionType>> &edges)
+{
+	// add the edges one by one like AddEdge() while the edge lists stay short, which keeps
+	//	each vertex in cache from its lookup to its update. Once the lists checked for
+	//	duplicates hold more than twice their inline storage on average, grouping the rest
+	//	of the batch by source is cheaper than scanning them.
+	std::size_t added_num = 0;
+	std::size_t scanned_num = 0;
+	std::size_t first = 0;
+	std::vector<std::pair<uint32_t, uint32_t>> indices;
+	for (; first < edges.size(); ++first)
+	{
+		VertexType *src_vertex = GetVertex(std::get<0>(edges[first]));
+		VertexType *dst_vertex = GetVertex(std::get<1>(edges[first]));
+
+		scanned_num += src_vertex->edges_to_.size();
+		if (scanned_num > 2 * VertexType::InlineEdgeNum * (first + 1))
+		{
+			indices.reserve(edges.size() - first);
+			indices.emplace_back(src_vertex->vertex_index_, dst_vertex->vertex_index_);
+			break;
+		}
+
+		if (InsertEdge(src_vertex, dst_vertex, std::get<2>(edges[first])))
+			++added_num;
+	}
+	if (first == edges.size())
+		return added_num;
+
+	// resolve the remaining vertices first, the rest is then handled with dense indices only
+	for (std::size_t i = first + 1; i < edges.size(); ++i)
+	{
+		VertexType *src_vertex = GetVertex(std::get<0>(edges[i]));
+		VertexType *dst_vertex = GetVertex(std::get<1>(edges[i]));
+		indices.emplace_back(src_vertex->vertex_index_, dst_vertex->vertex_index_);
+	}
+
+	// group the batch by source with a counting sort, which keeps the order of the batch
+	//	within a group so that the first of duplicated edges is kept
+	const std::size_t index_bound = vertex_table_.size();
+	std::vector<uint32_t> group_begin(index_bound + 1, 0);
+	for (const auto &index : indices)
+		++group_begin[index.first + 1];
+	for (std::size_t i = 0; i < index_bound; ++i)
+		group_begin[i + 1] += group_begin[i];
+	std::vector<uint32_t> order(indices.size());
+	{
+		std::vector<uint32_t> cursor(group_begin.begin(), group_begin.end() - 1);
+		for (uint32_t i = 0; i < indices.size(); ++i)
+			order[cursor[indices[i].first]++] = i;
+	}
+
+	// drop duplicates and edges that already exist in one pass: the successors of a source,
+	//	existing and kept so far, are marked with its index while its group is checked
+	std::vector<uint32_t> marked_by(index_bound, UINT32_MAX);
+	std::vector<uint32_t> in_degree(index_bound, 0);
+	std::vector<uint32_t> group_end(index_bound, 0);
+	std::size_t kept_num = 0;
+	for (uint32_t src_index = 0; src_index < index_bound; ++src_index)
 	{
-		auto idx = src_vertex->edges_to_.end();
-		bool found_edge = false;
-		for (auto it = src_vertex->edges_to_.begin(); it != src_vertex->edges_to_.end(); it++)
+		uint32_t kept_end = group_begin[src_index];
+		if (group_begin[src_index] != group_begin[src_index + 1])
 		{
-			if ((*it).dst_ == dst_vertex)
+			for (const auto &edge : vertex_table_[src_index]->edges_to_)
+				marked_by[edge.dst_->vertex_index_] = src_index;
+
+			for (uint32_t pos = group_begin[src_index]; pos < group_begin[src_index + 1]; ++pos)
 			{
-				idx = it;
-				found_edge = true;
+				uint32_t dst_index = indices[order[pos]].second;
+				if (marked_by[dst_index] == src_index)
+					continue;
+				marked_by[dst_index] = src_index;
+				++in_degree[dst_index];
+				order[kept_end++] = order[pos];
 			}
 		}
+		group_end[src_index] = kept_end;
+		kept_num += kept_end - group_begin[src_index];
+	}
+
+	// size the edge lists exactly before appending
+	for (uint32_t i = 0; i < index_bound; ++i)
+	{
+		if (in_degree[i] > 0)
+			vertex_table_[i]->edges_from_.reserve(vertex_table_[i]->edges_from_.size() + in_degree[i]);
+	}
+	if (edge_index_built_)
+		edge_index_.reserve(edge_index_.size() + kept_num);
 
-		if (found_edge)
-			src_vertex->edges_to_.erase(idx);
+	for (uint32_t src_index = 0; src_index < index_bound; ++src_index)
+	{
+		if (group_begin[src_index] == group_end[src_index])
+			continue;
 
-		return found_edge;
+		VertexType *src_vertex = vertex_table_[src_index];
+		src_vertex->edges_to_.reserve(src_vertex->edges_to_.size() + group_end[src_index] - group_begin[src_index]);
+		for (uint32_t pos = group_begin[src_index]; pos < group_end[src_index]; ++pos)
+		{
+			VertexType *dst_vertex = vertex_table_[indices[order[pos]].second];
+			TransitionType cost = std::get<2>(edges[first + order[pos]]);
+
+			if (edge_index_built_)
+				edge_index_.insert(GetEdgeKey(src_vertex, dst_vertex), EdgeSlot{static_cast<uint32_t>(src_vertex->edges_to_.size()), static_cast<uint32_t>(dst_vertex->edges_from_.size())});
+			dst_vertex->edges_from_.emplace_back(src_vertex, cost);
+			src_vertex->edges_to_.emplace_back(dst_vertex, cost);
+		}
 	}
+
+	return added_num + kept_num;
+}
+
+/// This function makes room for the given total number of vertices and edges
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::Reserve(std::size_t vertex_num, std::size_t edge_num)
+{
+	vertex_map_.reserve(vertex_num);
+	vertex_table_.reserve(vertex_num);
+	if (edge_index_built_)
+		edge_index_.reserve(edge_num);
+}
+
+/// This function returns the bytes of memory allocated by the graph
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::size_t Graph_t<StateType, TransitionType, IDIndexType>::GetMemorySize() const
+{
+	return arena_.GetReservedSize() + vertex_map_.GetMemorySize() + edge_index_.GetMemorySize() +
+		   vertex_table_.capacity() * sizeof(VertexType *) + free_indices_.capacity() * sizeof(uint32_t);
+}
+
+/// This function is used to remove the edge from src_node to dst_node.
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool Graph_t<StateType, TransitionType, IDIndexType>::RemoveEdge(StateType src_node, StateType dst_node)
+{
+	Vertex_t<StateType, TransitionType> *src_vertex = SearchVertex(src_node);
+	Vertex_t<StateType, TransitionType> *dst_vertex = SearchVertex(dst_node);
+
+	if ((src_vertex != nullptr) && (dst_vertex != nullptr))
+		return EraseEdge(src_vertex, dst_vertex);
 	else
 		return false;
 };
 
+/// This function changes the cost of the edge from src_node to dst_node.
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool Graph_t<StateType, TransitionType, IDIndexType>::UpdateEdgeCost(StateType src_node, StateType dst_node, TransitionType cost)
+{
+	Vertex_t<StateType, TransitionType> *src_vertex = SearchVertex(src_node);
+	Vertex_t<StateType, TransitionType> *dst_vertex = SearchVertex(dst_node);
+
+	if ((src_vertex == nullptr) || (dst_vertex == nullptr))
+		return false;
+
+	return SetEdgeCost(src_vertex, dst_vertex, cost);
+}
+
+/// This function applies a batch of (src_node, dst_node, cost) updates.
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::size_t Graph_t<StateType, TransitionType, IDIndexType>::UpdateEdgeCosts(const std::vector<std::tuple<StateType, StateType, TransitionType>> &updates)
+{
+	std::size_t updated_num = 0;
+
+	for (const auto &update : updates)
+	{
+		if (UpdateEdgeCost(std::get<0>(update), std::get<1>(update), std::get<2>(update)))
+			++updated_num;
+	}
+
+	return updated_num;
+}
+
 /// This function is used to create a graph by adding edges connecting two nodes
-template <typename StateType, typename TransitionType>
-void Graph_t<StateType, TransitionType>::AddUndirectedEdge(StateType src_node, StateType dst_node, TransitionType cost)
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void Graph_t<StateType, TransitionType, IDIndexType>::AddUndirectedEdge(StateType src_node, StateType dst_node, TransitionType cost)
 {
-	AddEdge(src_node, dst_node);
-	AddEdge(dst_node, src_node);
+	AddEdge(src_node, dst_node, cost);
+	AddEdge(dst_node, src_node, cost);
 }
 
-/// This function is used to remove the edge from src_node to dst_node.
-template <typename StateType, typename TransitionType>
-bool Graph_t<StateType, TransitionType>::RemoveUndirectedEdge(StateType src_node, StateType dst_node)
+/// This function is used to remove the edges between src_node and dst_node.
+template <typename StateType, typename TransitionType, typename IDIndexType>
+bool Graph_t<StateType, TransitionType, IDIndexType>::RemoveUndirectedEdge(StateType src_node, StateType dst_node)
 {
-	RemoveEdge(src_node, dst_node);
-	RemoveEdge(dst_node, src_node);
+	bool removed_forward = RemoveEdge(src_node, dst_node);
+	bool removed_backward = RemoveEdge(dst_node, src_node);
+
+	return removed_forward || removed_backward;
 }
 
 /// This function creates a vertex in the graph that associates with the given node.
 /// The set of functions AddVertex() are only supposed to be used with incremental a* search.
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<!std::is_pointer<T>::value>::type *>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::AddVertex(T vertex_node)
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::AddVertex(StateType vertex_node)
 {
-	Vertex_t<StateType, TransitionType> *new_vertex = new Vertex_t<StateType, TransitionType>(vertex_node);
-	//vertex_map_[vertex_node.GetUniqueID()] = new_vertex;
-	vertex_map_.insert(std::make_pair(vertex_node.GetUniqueID(), new_vertex));
-	return new_vertex;
+	return InsertVertex(vertex_node);
 }
 
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<std::is_pointer<T>::value>::type *>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::AddVertex(T vertex_node)
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::AddVertex(StateType vertex_node)
 {
-	Vertex_t<StateType, TransitionType> *new_vertex = new Vertex_t<StateType, TransitionType>(vertex_node);
-	//vertex_map_[vertex_node->GetUniqueID()] = new_vertex;
-	vertex_map_.insert(std::make_pair(vertex_node->GetUniqueID(), new_vertex));
-	return new_vertex;
+	return InsertVertex(vertex_node);
 }
 
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<!std::is_pointer<T>::value>::type *>
-void Graph_t<StateType, TransitionType>::RemoveVertex(T vertex_node)
+void Graph_t<StateType, TransitionType, IDIndexType>::RemoveVertex(StateType vertex_node)
 {
 	auto it = vertex_map_.find((uint64_t)(vertex_node.GetUniqueID()));
 
 	// unknown vertex, no need to remove
-	if (it == vertex_map_.end())
+	if (it == nullptr)
 		return;
 
-	for (auto &asv : it->second->vertices_from_)
-		for (auto eit = asv->edges_to_.begin(); eit != asv->edges_to_.end(); eit++)
-		{
-			if ((*eit).dst_ == it->second)
-			{
-				asv->edges_to_.erase(eit);
-				break;
-			}
-		}
-
-	auto vptr = it->second;
-	vertex_map_.erase(it);
-	delete vptr;
+	// remove the edges from and to the vertex in its neighbours
+	auto vptr = *it;
+	while (!vptr->edges_from_.empty())
+		EraseEdge(vptr->edges_from_.back().src_, vptr);
+	while (!vptr->edges_to_.empty())
+		EraseEdge(vptr, vptr->edges_to_.back().dst_);
+
+	vertex_table_[vptr->vertex_index_] = nullptr;
+	free_indices_.push_back(vptr->vertex_index_);
+	vertex_map_.erase(vptr->vertex_id_);
+	DestroyVertex(vptr);
 };
 
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<std::is_pointer<T>::value>::type *>
-void Graph_t<StateType, TransitionType>::RemoveVertex(T vertex_node)
+void Graph_t<StateType, TransitionType, IDIndexType>::RemoveVertex(StateType vertex_node)
 {
 	auto it = vertex_map_.find((uint64_t)(vertex_node->GetUniqueID()));
 
 	// unknown vertex, no need to remove
-	if (it == vertex_map_.end())
+	if (it == nullptr)
 		return;
 
-	for (auto &asv : it->second->vertices_from_)
-		for (auto eit = asv->edges_to_.begin(); eit != asv->edges_to_.end(); eit++)
-		{
-			if ((*eit).dst_ == it->second)
-			{
-				asv->edges_to_.erase(eit);
-				break;
-			}
-		}
-
-	auto vptr = it->second;
-	vertex_map_.erase(it);
-	delete vptr;
+	// remove the edges from and to the vertex in its neighbours
+	auto vptr = *it;
+	while (!vptr->edges_from_.empty())
+		EraseEdge(vptr->edges_from_.back().src_, vptr);
+	while (!vptr->edges_to_.empty())
+		EraseEdge(vptr, vptr->edges_to_.back().dst_);
+
+	vertex_table_[vptr->vertex_index_] = nullptr;
+	free_indices_.push_back(vptr->vertex_index_);
+	vertex_map_.erase(vptr->vertex_id_);
+	DestroyVertex(vptr);
 }
 
 /// This functions is used to access all vertices of a graph
-template <typename StateType, typename TransitionType>
-std::vector<Vertex_t<StateType, TransitionType> *> Graph_t<StateType, TransitionType>::GetGraphVertices() const
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::vector<Vertex_t<StateType, TransitionType> *> Graph_t<StateType, TransitionType, IDIndexType>::GetGraphVertices() const
 {
 	std::vector<Vertex_t<StateType, TransitionType> *> vertices;
 
-	for (auto &vertex_pair : vertex_map_)
-		vertices.push_back(vertex_pair.second);
+	for (auto vertex : vertex_table_)
+	{
+		if (vertex != nullptr)
+			vertices.push_back(vertex);
+	}
 
 	return vertices;
 };
 
 /// This functions is used to access all edges of a graph
-template <typename StateType, typename TransitionType>
-std::vector<Edge_t<StateType, TransitionType>> Graph_t<StateType, TransitionType>::GetGraphEdges() const
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::vector<Edge_t<StateType, TransitionType>> Graph_t<StateType, TransitionType, IDIndexType>::GetGraphEdges() const
 {
 	std::vector<Edge_t<StateType, TransitionType>> edges;
 
-	for (auto &vertex_pair : vertex_map_)
+	for (auto vertex : vertex_table_)
 	{
-		Vertex_t<StateType, TransitionType> *vertex = vertex_pair.second;
-		for(auto edge:vertex->edges_to_)
-			edges.push_back(edge);
+		if (vertex == nullptr)
+			continue;
+		for (const auto &edge : vertex->edges_to_)
+			edges.emplace_back(vertex, edge.dst_, edge.cost_);
 	}
 
 	return edges;
 };
 
 /// This functions is used to access all edges of a graph
-template <typename StateType, typename TransitionType>
-std::vector<Edge_t<StateType, TransitionType>> Graph_t<StateType, TransitionType>::GetGraphUndirectedEdges() const
+template <typename StateType, typename TransitionType, typename IDIndexType>
+std::vector<Edge_t<StateType, TransitionType>> Graph_t<StateType, TransitionType, IDIndexType>::GetGraphUndirectedEdges() const
 {
 	std::vector<Edge_t<StateType, TransitionType>> edges;
 
-	for (auto &vertex_pair : vertex_map_)
+	for (auto vertex : vertex_table_)
 	{
-		Vertex_t<StateType, TransitionType> *vertex = vertex_pair.second;
+		if (vertex == nullptr)
+			continue;
 
 		for (auto ite = vertex->edges_to_.begin(); ite != vertex->edges_to_.end(); ite++)
 		{
+			EdgeType edge(vertex, ite->dst_, ite->cost_);
 			bool edge_existed = false;
 
 			for (auto &itedge : edges)
 			{
-				if (itedge -= (*ite))
+				if (itedge -= edge)
 				{
 					edge_existed = true;
 					break;
@@ -237,72 +554,66 @@ std::vector<Edge_t<StateType, TransitionType>> Graph_t<StateType, TransitionType
 			}
 
 			if (!edge_existed)
-				edges.push_back(*ite);
+				edges.push_back(edge);
 		}
 	}
 
 	return edges;
 };
 
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<!std::is_pointer<T>::value>::type *>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::GetVertex(T vertex_node)
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::GetVertex(StateType vertex_node)
 {
 	auto it = vertex_map_.find((uint64_t)(vertex_node.GetUniqueID()));
 
-	if (it == vertex_map_.end())
+	if (it == nullptr)
 	{
-		Vertex_t<StateType, TransitionType> *new_vertex = new Vertex_t<StateType, TransitionType>(vertex_node);
-		//vertex_map_[vertex_node.GetUniqueID()] = new_vertex;
-		vertex_map_.insert(std::make_pair(vertex_node.GetUniqueID(), new_vertex));
-		return new_vertex;
+		return InsertVertex(vertex_node);
 	}
 
-	return it->second;
+	return *it;
 }
 
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<std::is_pointer<T>::value>::type *>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::GetVertex(T vertex_node)
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::GetVertex(StateType vertex_node)
 {
 	auto it = vertex_map_.find((uint64_t)(vertex_node->GetUniqueID()));
 
-	if (it == vertex_map_.end())
+	if (it == nullptr)
 	{
-		Vertex_t<StateType, TransitionType> *new_vertex = new Vertex_t<StateType, TransitionType>(vertex_node);
-		//vertex_map_[vertex_node->GetUniqueID()] = new_vertex;
-		vertex_map_.insert(std::make_pair(vertex_node->GetUniqueID(), new_vertex));
-		return new_vertex;
+		return InsertVertex(vertex_node);
 	}
 
-	return it->second;
+	return *it;
 }
 
 /// This function checks if a vertex exists in the graph.
 ///	If yes, the functions returns the pointer of the existing vertex,
 ///	otherwise it returns nullptr.
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<!std::is_pointer<T>::value>::type *>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::SearchVertex(T vertex_node)
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::SearchVertex(StateType vertex_node)
 {
 	auto it = vertex_map_.find((uint64_t)(vertex_node.GetUniqueID()));
 
-	if (it == vertex_map_.end())
+	if (it == nullptr)
 		return nullptr;
 	else
-		return it->second;
+		return *it;
 }
 
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType, typename IDIndexType>
 template <class T, typename std::enable_if<std::is_pointer<T>::value>::type *>
-Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType>::SearchVertex(T vertex_node)
+Vertex_t<StateType, TransitionType> *Graph_t<StateType, TransitionType, IDIndexType>::SearchVertex(StateType vertex_node)
 {
 	auto it = vertex_map_.find((uint64_t)(vertex_node->GetUniqueID()));
 
-	if (it == vertex_map_.end())
+	if (it == nullptr)
 		return nullptr;
 	else
-		return it->second;
+		return *it;
 }
 }
 
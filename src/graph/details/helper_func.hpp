@@ -11,6 +11,7 @@
 #define HELPER_FUNC_HPP
 
 #include <cstdint>
+#include <type_traits>
 
 namespace librav
 {
@@ -55,6 +56,20 @@ struct HasIDGenFunc
 
     static const bool value = type::value; /* Which is it? */
 };
+
+/// Get the unique id of a state that is stored by value or by reference
+template <typename T, typename std::enable_if<!std::is_pointer<T>::value>::type * = nullptr>
+inline uint64_t GetStateID(const T &state)
+{
+    return state.GetUniqueID();
+}
+
+/// Get the unique id of a state that is stored as a pointer
+template <typename T, typename std::enable_if<std::is_pointer<T>::value>::type * = nullptr>
+inline uint64_t GetStateID(const T &state)
+{
+    return state->GetUniqueID();
+}
 }
 
 #endif /* HELPER_FUNC_HPP */
@@ -0,0 +1,350 @@
+/*
+ * id_index.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: hash maps keyed by 64-bit ids, used as vertex and edge index of Graph_t
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef ID_INDEX_HPP
+#define ID_INDEX_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace librav
+{
+
+/// An open-addressing hash map from 64-bit ids to values, using Robin Hood hashing.
+///
+/// All entries are stored in one flat array, so a lookup usually touches a single cache
+///	line and inserting an entry doesn't allocate unless the table grows. Each slot records
+///	how far it is from its home slot. Insertion lets an entry take the slot of an entry that
+///	is closer to its home, which keeps the probe sequences short at a load factor of up to
+///	3/4. Erasing shifts the following entries back instead of leaving tombstones.
+///
+/// Pointers returned by find() and insert() are invalidated by any later insert() or erase().
+template <typename ValueType>
+class FlatIDMap
+{
+  public:
+	inline bool empty() const { return size_ == 0; }
+
+	inline std::size_t size() const { return size_; }
+
+	/// Find the value associated with the key, nullptr is returned if the key is not in the map
+	inline ValueType *find(uint64_t key)
+	{
+		if (size_ == 0)
+			return nullptr;
+
+		std::size_t pos = Hash(key) & mask_;
+		for (uint32_t dist = 1; slots_[pos].dist_ >= dist; ++dist)
+		{
+			if (slots_[pos].key_ == key)
+				return &slots_[pos].value_;
+			pos = (pos + 1) & mask_;
+		}
+		return nullptr;
+	}
+
+	inline const ValueType *find(uint64_t key) const
+	{
+		return const_cast<FlatIDMap *>(this)->find(key);
+	}
+
+	/// Insert the key with the given value unless it's already in the map. The returned flag
+	///	is false if the key existed, the pointer refers to the value stored in the map.
+	std::pair<ValueType *, bool> insert(uint64_t key, ValueType value)
+	{
+		ValueType *existing = find(key);
+		if (existing != nullptr)
+			return std::make_pair(existing, false);
+
+		if ((size_ + 1) * 4 > slots_.size() * 3)
+			Rehash(slots_.empty() ? 16 : slots_.size() * 2);
+
+		++size_;
+		Slot entry{key, std::move(value), 1};
+		ValueType *inserted = nullptr;
+		for (std::size_t pos = Hash(key) & mask_;; pos = (pos + 1) & mask_, ++entry.dist_)
+		{
+			Slot &slot = slots_[pos];
+			if (slot.dist_ == 0)
+			{
+				slot = std::move(entry);
+				return std::make_pair(inserted == nullptr ? &slot.value_ : inserted, true);
+			}
+
+			// take the slot of an entry that is closer to its home slot
+			if (slot.dist_ < entry.dist_)
+			{
+				std::swap(slot, entry);
+				if (inserted == nullptr)
+					inserted = &slot.value_;
+			}
+		}
+	}
+
+	/// Remove the key from the map, false is returned if it's not in the map
+	bool erase(uint64_t key)
+	{
+		if (size_ == 0)
+			return false;
+
+		std::size_t pos = Hash(key) & mask_;
+		for (uint32_t dist = 1;; ++dist)
+		{
+			if (slots_[pos].dist_ < dist)
+				return false;
+			if (slots_[pos].key_ == key)
+				break;
+			pos = (pos + 1) & mask_;
+		}
+
+		// shift the following entries of the probe sequence back by one slot
+		for (std::size_t next = (pos + 1) & mask_; slots_[next].dist_ > 1; pos = next, next = (next + 1) & mask_)
+		{
+			slots_[pos] = std::move(slots_[next]);
+			--slots_[pos].dist_;
+		}
+		slots_[pos] = Slot();
+		--size_;
+
+		return true;
+	}
+
+	/// Remove all entries, the memory of the table is kept
+	void clear()
+	{
+		for (auto &slot : slots_)
+			slot = Slot();
+		size_ = 0;
+	}
+
+	/// Make room for the given number of entries without growing the table again
+	void reserve(std::size_t entry_num)
+	{
+		std::size_t capacity = 16;
+		while (entry_num * 4 > capacity * 3)
+			capacity *= 2;
+		if (capacity > slots_.size())
+			Rehash(capacity);
+	}
+
+	/// Bytes of memory allocated by the map
+	std::size_t GetMemorySize() const { return slots_.capacity() * sizeof(Slot); }
+
+  private:
+	struct Slot
+	{
+		uint64_t key_ = 0;
+		ValueType value_ = ValueType();
+		// distance to the home slot plus one, 0 marks an empty slot
+		uint32_t dist_ = 0;
+	};
+
+	std::vector<Slot> slots_;
+	std::size_t mask_ = 0;
+	uint32_t shift_ = 64;
+	std::size_t size_ = 0;
+
+	// ids are often sequential, strided or generated by a linear formula, all bits are mixed
+	//	(MurmurHash3 finalizer) before the high bits are used as home slot
+	inline std::size_t Hash(uint64_t key) const
+	{
+		key ^= key >> 33;
+		key *= 0xff51afd7ed558ccdULL;
+		key ^= key >> 33;
+		key *= 0xc4ceb9fe1a85ec53ULL;
+		key ^= key >> 33;
+		return static_cast<std::size_t>(key >> shift_);
+	}
+
+	void Rehash(std::size_t capacity)
+	{
+		std::vector<Slot> old_slots(capacity);
+		old_slots.swap(slots_);
+		mask_ = capacity - 1;
+		shift_ = 64;
+		for (std::size_t c = capacity; c > 1; c >>= 1)
+			--shift_;
+		size_ = 0;
+
+		for (auto &slot : old_slots)
+		{
+			if (slot.dist_ != 0)
+				insert(slot.key_, std::move(slot.value_));
+		}
+	}
+};
+
+/// std::unordered_map with the interface of FlatIDMap. It allocates one node per entry but
+///	pointers to the values stay valid until the entry is erased.
+template <typename ValueType>
+class StdIDMap
+{
+  public:
+	inline bool empty() const { return map_.empty(); }
+
+	inline std::size_t size() const { return map_.size(); }
+
+	inline ValueType *find(uint64_t key)
+	{
+		auto it = map_.find(key);
+		return (it == map_.end()) ? nullptr : &it->second;
+	}
+
+	inline const ValueType *find(uint64_t key) const
+	{
+		auto it = map_.find(key);
+		return (it == map_.end()) ? nullptr : &it->second;
+	}
+
+	std::pair<ValueType *, bool> insert(uint64_t key, ValueType value)
+	{
+		auto result = map_.insert(std::make_pair(key, std::move(value)));
+		return std::make_pair(&result.first->second, result.second);
+	}
+
+	bool erase(uint64_t key) { return map_.erase(key) > 0; }
+
+	void clear() { map_.clear(); }
+
+	void reserve(std::size_t entry_num) { map_.reserve(entry_num); }
+
+	/// Estimated bytes of memory allocated by the map: the bucket array and a node with a
+	///	next pointer per entry, the allocator overhead isn't counted
+	std::size_t GetMemorySize() const
+	{
+		return map_.bucket_count() * sizeof(void *) + map_.size() * (sizeof(void *) + sizeof(std::pair<const uint64_t, ValueType>));
+	}
+
+  private:
+	std::unordered_map<uint64_t, ValueType> map_;
+};
+
+/// A map for ids that are dense, e.g. y * cols + x for the cells of a grid. The values are
+///	stored in an array indexed directly by the id and a bitset marks the ids in use, so no
+///	hashing is done at all. The array covers the largest id inserted so far, reserve() can
+///	be used to allocate it for the whole id range up front. Don't use it for scattered ids.
+///	Ids above MaxID are rejected with std::out_of_range, before anything is allocated.
+///
+/// Pointers returned by find() and insert() are invalidated by an insert() that grows the array.
+template <typename ValueType>
+class DenseIDMap
+{
+  public:
+	static constexpr uint64_t MaxID = (uint64_t(1) << 32) - 1;
+
+	inline bool empty() const { return size_ == 0; }
+
+	inline std::size_t size() const { return size_; }
+
+	inline ValueType *find(uint64_t key)
+	{
+		return (key < used_.size() && used_[key]) ? &values_[key] : nullptr;
+	}
+
+	inline const ValueType *find(uint64_t key) const
+	{
+		return (key < used_.size() && used_[key]) ? &values_[key] : nullptr;
+	}
+
+	std::pair<ValueType *, bool> insert(uint64_t key, ValueType value)
+	{
+		if (key >= used_.size())
+		{
+			if (key > MaxID)
+				throw std::out_of_range("DenseIDMap: id above DenseIDMap::MaxID");
+			Resize(std::min<std::size_t>(std::max<std::size_t>(key + 1, used_.size() * 2), MaxID + 1));
+		}
+		else if (used_[key])
+			return std::make_pair(&values_[key], false);
+
+		values_[key] = std::move(value);
+		used_[key] = true;
+		++size_;
+
+		return std::make_pair(&values_[key], true);
+	}
+
+	bool erase(uint64_t key)
+	{
+		if (key >= used_.size() || !used_[key])
+			return false;
+
+		values_[key] = ValueType();
+		used_[key] = false;
+		--size_;
+
+		return true;
+	}
+
+	void clear()
+	{
+		values_.assign(values_.size(), ValueType());
+		used_.assign(used_.size(), false);
+		size_ = 0;
+	}
+
+	/// Allocate the array for the ids from 0 to id_bound - 1
+	void reserve(std::size_t id_bound)
+	{
+		if (id_bound > MaxID + 1)
+			throw std::out_of_range("DenseIDMap: id bound above DenseIDMap::MaxID + 1");
+		if (id_bound > used_.size())
+			Resize(id_bound);
+	}
+
+	/// Bytes of memory allocated by the map
+	std::size_t GetMemorySize() const { return values_.capacity() * sizeof(ValueType) + used_.capacity() / 8; }
+
+  private:
+	std::vector<ValueType> values_;
+	std::vector<bool> used_;
+	std::size_t size_ = 0;
+
+	void Resize(std::size_t id_bound)
+	{
+		values_.resize(id_bound);
+		used_.resize(id_bound, false);
+	}
+};
+
+template <typename ValueType>
+constexpr uint64_t DenseIDMap<ValueType>::MaxID;
+
+/// Id index policies, given as the IDIndexType parameter of Graph_t to select the map
+///	used to find a vertex by its id:
+///
+///		Graph_t<GridCell, double, DenseIDIndex> graph;
+///
+/// Any type with a member template MapType<ValueType> that has the interface of FlatIDMap
+///	can be used as well, GetMemorySize() is only needed by Graph_t::GetMemorySize().
+struct FlatIDIndex
+{
+	template <typename ValueType>
+	using MapType = FlatIDMap<ValueType>;
+};
+
+struct StdIDIndex
+{
+	template <typename ValueType>
+	using MapType = StdIDMap<ValueType>;
+};
+
+struct DenseIDIndex
+{
+	template <typename ValueType>
+	using MapType = DenseIDMap<ValueType>;
+};
+}
+
+#endif /* ID_INDEX_HPP */
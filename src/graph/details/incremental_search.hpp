@@ -0,0 +1,262 @@
+/*
+ * incremental_search.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: search information shared by LPA* and D* Lite
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef INCREMENTAL_SEARCH_HPP
+#define INCREMENTAL_SEARCH_HPP
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "graph/graph.hpp"
+
+namespace librav
+{
+
+/// The g-values, rhs-values and open list of an incremental search, shared by LPAStar and
+///	DStarLite.
+///
+/// The search grows from a root vertex, whose rhs-value is 0, until the g-value of a target
+///	vertex is consistent. LPA* grows forward from the start to the goal along edges_to_,
+///	D* Lite (Reverse = true) grows backward from the goal to the start along edges_from_.
+///	The heuristic is called as calc_heuristic(state, target_state). Keys are offset by
+///	key_modifier_, which D* Lite raises when the start moves.
+template <typename StateType, typename TransitionType, typename IDIndexType, typename HeuristicFunc, bool Reverse>
+class IncrementalSearchBase
+{
+  public:
+	/// Number of vertices expanded by the last call to ComputeShortestPath()
+	std::size_t GetExpansionNumber() const { return expansion_num_; }
+
+  protected:
+	typedef Vertex_t<StateType, TransitionType> VertexType;
+	typedef std::pair<double, double> Key;
+	typedef std::pair<Key, uint32_t> QueueElement;
+	typedef std::priority_queue<QueueElement, std::vector<QueueElement>, std::greater<QueueElement>> OpenList;
+
+	IncrementalSearchBase(Graph_t<StateType, TransitionType, IDIndexType> &graph, HeuristicFunc calc_heuristic) : graph_(graph), calc_heuristic_(calc_heuristic) {}
+
+	Graph_t<StateType, TransitionType, IDIndexType> &graph_;
+	HeuristicFunc calc_heuristic_;
+
+	VertexType *root_ = nullptr;
+	VertexType *target_ = nullptr;
+	double key_modifier_ = 0;
+	std::size_t expansion_num_ = 0;
+
+	// per-vertex search information, indexed by Vertex_t::vertex_index_. g_ is the
+	//	distance from the root.
+	std::vector<double> g_;
+	std::vector<double> rhs_;
+	std::vector<Key> queued_key_;
+	std::vector<bool> in_openlist_;
+	OpenList openlist_;
+
+	static constexpr double Infinity() { return std::numeric_limits<double>::infinity(); }
+
+	/// Discard all search information and start from the root, returns false if either
+	///	vertex is missing
+	bool Reset(VertexType *root, VertexType *target)
+	{
+		root_ = root;
+		target_ = target;
+		if (root_ == nullptr || target_ == nullptr)
+		{
+			root_ = target_ = nullptr;
+			return false;
+		}
+
+		key_modifier_ = 0;
+		g_.assign(graph_.GetVertexIndexBound(), Infinity());
+		rhs_.assign(graph_.GetVertexIndexBound(), Infinity());
+		queued_key_.assign(graph_.GetVertexIndexBound(), Key(Infinity(), Infinity()));
+		in_openlist_.assign(graph_.GetVertexIndexBound(), false);
+		openlist_ = OpenList();
+
+		rhs_[root_->vertex_index_] = 0;
+		Push(root_);
+
+		return true;
+	}
+
+	/// Expand vertices until the target is consistent and no queued vertex has a smaller key.
+	///	The path from the root to the target is returned in search order, so from the target
+	///	to the root if Reverse is set. It's empty if the target can't be reached.
+	Path_t<StateType, TransitionType> UpdatePath()
+	{
+		Path_t<StateType, TransitionType> path;
+		expansion_num_ = 0;
+		if (root_ == nullptr)
+			return path;
+
+		Reserve(target_->vertex_index_);
+		const uint32_t target_idx = target_->vertex_index_;
+		while (true)
+		{
+			// skip outdated entries, a vertex is queued again whenever its key changes
+			while (!openlist_.empty() && (!in_openlist_[openlist_.top().second] || openlist_.top().first != queued_key_[openlist_.top().second]))
+				openlist_.pop();
+
+			if (openlist_.empty() || (!(openlist_.top().first < CalculateKey(target_)) && rhs_[target_idx] == g_[target_idx]))
+				break;
+
+			Key old_key = openlist_.top().first;
+			VertexType *current = graph_.GetVertexFromIndex(openlist_.top().second);
+			const uint32_t current_idx = current->vertex_index_;
+			openlist_.pop();
+			in_openlist_[current_idx] = false;
+
+			// the key was computed with an older key modifier
+			if (key_modifier_ > 0 && old_key < CalculateKey(current))
+			{
+				Push(current);
+				continue;
+			}
+			++expansion_num_;
+
+			if (g_[current_idx] > rhs_[current_idx])
+			{
+				// locally overconsistent: the vertex gets cheaper
+				g_[current_idx] = rhs_[current_idx];
+			}
+			else
+			{
+				// locally underconsistent: the vertex gets more expensive
+				g_[current_idx] = Infinity();
+				UpdateVertex(current);
+			}
+
+			ForEachChild(current, [this](VertexType *child, TransitionType) { UpdateVertex(child); });
+		}
+
+		if (g_[target_idx] == Infinity())
+			return path;
+
+		// follow the best parents from the target back to the root
+		for (VertexType *waypoint = target_; waypoint != root_;)
+		{
+			path.push_back(waypoint);
+
+			VertexType *best_parent = nullptr;
+			double best_cost = Infinity();
+			ForEachParent(waypoint, [this, &best_parent, &best_cost](VertexType *parent, TransitionType cost) {
+				double parent_cost = GetG(parent) + cost;
+				if (parent_cost < best_cost)
+				{
+					best_cost = parent_cost;
+					best_parent = parent;
+				}
+			});
+			waypoint = best_parent;
+			if (waypoint == nullptr)
+				return Path_t<StateType, TransitionType>();
+		}
+		path.push_back(root_);
+		if (!Reverse)
+			std::reverse(path.begin(), path.end());
+
+		return path;
+	}
+
+	/// Update the search after the edges into the given vertex (out of it with Reverse)
+	///	changed, vertex_id may refer to a vertex that is not in the graph
+	void NotifyChange(uint64_t vertex_id)
+	{
+		VertexType *vertex = graph_.GetVertexFromID(vertex_id);
+		if (vertex != nullptr && root_ != nullptr)
+			UpdateVertex(vertex);
+	}
+
+	// vertices may be added to the graph after the search started
+	void Reserve(uint32_t vertex_index)
+	{
+		if (vertex_index >= g_.size())
+		{
+			g_.resize(graph_.GetVertexIndexBound(), Infinity());
+			rhs_.resize(graph_.GetVertexIndexBound(), Infinity());
+			queued_key_.resize(graph_.GetVertexIndexBound(), Key(Infinity(), Infinity()));
+			in_openlist_.resize(graph_.GetVertexIndexBound(), false);
+		}
+	}
+
+	double GetG(VertexType *vertex) const
+	{
+		return (vertex->vertex_index_ < g_.size()) ? g_[vertex->vertex_index_] : Infinity();
+	}
+
+	Key CalculateKey(VertexType *vertex) const
+	{
+		double cost = std::min(g_[vertex->vertex_index_], rhs_[vertex->vertex_index_]);
+		return Key(cost + calc_heuristic_(vertex->state_, target_->state_) + key_modifier_, cost);
+	}
+
+	void Push(VertexType *vertex)
+	{
+		Key key = CalculateKey(vertex);
+		queued_key_[vertex->vertex_index_] = key;
+		in_openlist_[vertex->vertex_index_] = true;
+		openlist_.emplace(key, vertex->vertex_index_);
+	}
+
+	void UpdateVertex(VertexType *vertex)
+	{
+		const uint32_t idx = vertex->vertex_index_;
+		Reserve(idx);
+
+		if (vertex != root_)
+		{
+			double rhs = Infinity();
+			ForEachParent(vertex, [this, &rhs](VertexType *parent, TransitionType cost) { rhs = std::min(rhs, GetG(parent) + cost); });
+			rhs_[idx] = rhs;
+		}
+
+		if (g_[idx] != rhs_[idx])
+			Push(vertex);
+		else
+			in_openlist_[idx] = false;
+	}
+
+	// vertices the search reaches the given vertex from, with the cost of the edge between them
+	template <typename Func>
+	static void ForEachParent(VertexType *vertex, Func &&func)
+	{
+		if (Reverse)
+		{
+			for (auto &edge : vertex->edges_to_)
+				func(edge.dst_, edge.cost_);
+		}
+		else
+		{
+			for (auto &edge : vertex->edges_from_)
+				func(edge.src_, edge.cost_);
+		}
+	}
+
+	// vertices the search continues to from the given vertex
+	template <typename Func>
+	static void ForEachChild(VertexType *vertex, Func &&func)
+	{
+		if (Reverse)
+		{
+			for (auto &edge : vertex->edges_from_)
+				func(edge.src_, edge.cost_);
+		}
+		else
+		{
+			for (auto &edge : vertex->edges_to_)
+				func(edge.dst_, edge.cost_);
+		}
+	}
+};
+}
+
+#endif /* INCREMENTAL_SEARCH_HPP */
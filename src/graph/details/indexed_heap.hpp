@@ -0,0 +1,153 @@
+/*
+ * indexed_heap.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: indexed d-ary heap with decrease-key
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace librav
+{
+
+/// An indexed d-ary min-heap that can be used as A* open list.
+///
+/// Items are dense vertex indices. The heap keeps track of the position of every item, so
+///	putting an item that is already in the heap updates its priority in place (decrease-key)
+///	instead of adding a duplicate entry. The heap therefore never holds more entries than
+///	the live frontier of the search.
+template <std::size_t Arity = 4, typename Number = double>
+class IndexedDaryHeap
+{
+	static_assert(Arity >= 2, "heap arity must be at least 2");
+
+  public:
+	inline bool empty() const { return elements_.empty(); }
+
+	inline std::size_t size() const { return elements_.size(); }
+
+	/// Check if an item is currently in the heap
+	inline bool contains(uint32_t item) const
+	{
+		return item < position_.size() && position_[item] != npos;
+	}
+
+	/// Insert an item, or change its priority if it's already in the heap
+	inline void put(uint32_t item, Number priority)
+	{
+		if (item >= position_.size())
+			position_.resize(item + 1, npos);
+
+		std::size_t pos = position_[item];
+		if (pos == npos)
+		{
+			elements_.push_back(Element{priority, item});
+			SiftUp(elements_.size() - 1);
+		}
+		else if (priority < elements_[pos].priority)
+		{
+			elements_[pos].priority = priority;
+			SiftUp(pos);
+		}
+		else
+		{
+			elements_[pos].priority = priority;
+			SiftDown(pos);
+		}
+	}
+
+	/// Remove and return the item with the lowest priority
+	inline uint32_t get()
+	{
+		uint32_t best_item = elements_.front().item;
+		position_[best_item] = npos;
+
+		Element last = elements_.back();
+		elements_.pop_back();
+		if (!elements_.empty())
+		{
+			elements_.front() = last;
+			position_[last.item] = 0;
+			SiftDown(0);
+		}
+
+		return best_item;
+	}
+
+	/// Remove all items, the position table is kept for reuse
+	inline void clear()
+	{
+		for (const auto &element : elements_)
+			position_[element.item] = npos;
+		elements_.clear();
+	}
+
+  private:
+	struct Element
+	{
+		Number priority;
+		uint32_t item;
+	};
+
+	static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+	std::vector<Element> elements_;
+	std::vector<uint32_t> position_;
+
+	inline void SiftUp(std::size_t pos)
+	{
+		Element element = elements_[pos];
+		while (pos > 0)
+		{
+			std::size_t parent = (pos - 1) / Arity;
+			if (!(element.priority < elements_[parent].priority))
+				break;
+			elements_[pos] = elements_[parent];
+			position_[elements_[pos].item] = static_cast<uint32_t>(pos);
+			pos = parent;
+		}
+		elements_[pos] = element;
+		position_[element.item] = static_cast<uint32_t>(pos);
+	}
+
+	inline void SiftDown(std::size_t pos)
+	{
+		Element element = elements_[pos];
+		const std::size_t num = elements_.size();
+		while (true)
+		{
+			std::size_t first_child = pos * Arity + 1;
+			if (first_child >= num)
+				break;
+
+			// find the child with the lowest priority
+			std::size_t last_child = (first_child + Arity < num) ? first_child + Arity : num;
+			std::size_t best_child = first_child;
+			for (std::size_t child = first_child + 1; child < last_child; ++child)
+				if (elements_[child].priority < elements_[best_child].priority)
+					best_child = child;
+
+			if (!(elements_[best_child].priority < element.priority))
+				break;
+			elements_[pos] = elements_[best_child];
+			position_[elements_[pos].item] = static_cast<uint32_t>(pos);
+			pos = best_child;
+		}
+		elements_[pos] = element;
+		position_[element.item] = static_cast<uint32_t>(pos);
+	}
+};
+
+template <std::size_t Arity, typename Number>
+constexpr uint32_t IndexedDaryHeap<Arity, Number>::npos;
+}
+
+#endif /* INDEXED_HEAP_HPP */
@@ -0,0 +1,239 @@
+/*
+ * landmark_table_impl.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef LANDMARK_TABLE_IMPL_HPP
+#define LANDMARK_TABLE_IMPL_HPP
+
+#include <algorithm>
+#include <utility>
+
+#include "graph/details/priority_queue.hpp"
+#include "graph/details/best_first_search.hpp"
+
+namespace librav
+{
+
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+constexpr DistanceType LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::Unreachable;
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+constexpr double LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::RoundingError;
+
+/****************************************************************************/
+/*								 Heuristic									*/
+/****************************************************************************/
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+double LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::Heuristic::operator()(const StateType &state, const StateType &goal_state) const
+{
+	uint64_t goal_id = GetStateID(goal_state);
+	if (goal_index_ == std::numeric_limits<uint32_t>::max() || goal_id != goal_id_)
+	{
+		goal_id_ = goal_id;
+		goal_index_ = table_->GetVertexIndex(goal_state);
+	}
+
+	uint32_t vertex_index = table_->GetVertexIndex(state);
+	if (vertex_index == std::numeric_limits<uint32_t>::max() || goal_index_ == std::numeric_limits<uint32_t>::max())
+		return 0.0;
+
+	return table_->GetLowerBound(vertex_index, goal_index_, landmarks_);
+}
+
+/****************************************************************************/
+/*							  LandmarkTable_t								*/
+/****************************************************************************/
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::LandmarkTable_t(const Graph_t<StateType, TransitionType, IDIndexType> &graph, std::size_t landmark_num) : graph_(&graph)
+{
+	const std::size_t vertex_num = graph.GetVertexIndexBound();
+	const std::size_t k = std::min(landmark_num, graph.GetGraphVertices().size());
+
+	uint32_t candidate = 0;
+	while (candidate < vertex_num && graph.GetVertexFromIndex(candidate) == nullptr)
+		++candidate;
+	if (k == 0)
+		return;
+
+	// farthest selection: start from an arbitrary vertex, then repeatedly pick the vertex
+	//	with the largest distance to the closest landmark selected so far
+	std::vector<double> min_distances(vertex_num, std::numeric_limits<double>::infinity());
+	std::vector<double> distances;
+	ComputeDistances(candidate, true, distances);
+
+	distance_from_.assign(vertex_num * k, Unreachable);
+	distance_to_.assign(vertex_num * k, Unreachable);
+	for (std::size_t l = 0; l < k; ++l)
+	{
+		double max_distance = -1;
+		for (uint32_t v = 0; v < vertex_num; ++v)
+		{
+			if (graph.GetVertexFromIndex(v) == nullptr)
+				continue;
+			min_distances[v] = std::min(min_distances[v], distances[v]);
+			if (min_distances[v] > max_distance)
+			{
+				max_distance = min_distances[v];
+				candidate = v;
+			}
+		}
+
+		// another landmark wouldn't add any information
+		if (max_distance <= 0)
+			break;
+		landmark_ids_.push_back(graph.GetVertexFromIndex(candidate)->vertex_id_);
+
+		ComputeDistances(candidate, false, distances);
+		for (uint32_t v = 0; v < vertex_num; ++v)
+			if (distances[v] < std::numeric_limits<double>::infinity())
+				distance_to_[v * k + l] = static_cast<DistanceType>(distances[v]);
+
+		// the forward distances are also used to select the next landmark
+		ComputeDistances(candidate, true, distances);
+		for (uint32_t v = 0; v < vertex_num; ++v)
+			if (distances[v] < std::numeric_limits<double>::infinity())
+				distance_from_[v * k + l] = static_cast<DistanceType>(distances[v]);
+	}
+
+	// pack the tables if fewer landmarks than requested were selected
+	const std::size_t selected = landmark_ids_.size();
+	if (selected < k)
+	{
+		for (uint32_t v = 0; v < vertex_num; ++v)
+		{
+			for (std::size_t l = 0; l < selected; ++l)
+			{
+				distance_from_[v * selected + l] = distance_from_[v * k + l];
+				distance_to_[v * selected + l] = distance_to_[v * k + l];
+			}
+		}
+		distance_from_.resize(vertex_num * selected);
+		distance_to_.resize(vertex_num * selected);
+	}
+}
+
+/// Dijkstra search from the source to all vertices, along the edges if forward is true
+///	and against them otherwise
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+void LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::ComputeDistances(uint32_t source, bool forward, std::vector<double> &distances) const
+{
+	distances.assign(graph_->GetVertexIndexBound(), std::numeric_limits<double>::infinity());
+	std::vector<bool> settled(distances.size(), false);
+
+	PriorityQueue<uint32_t> openlist;
+	distances[source] = 0;
+	openlist.put(source, 0);
+
+	while (!openlist.empty())
+	{
+		uint32_t current = openlist.get();
+		if (settled[current])
+			continue;
+		settled[current] = true;
+
+		auto relax = [&](uint32_t neighbour, TransitionType cost) {
+			double new_cost = distances[current] + cost;
+			if (new_cost < distances[neighbour])
+			{
+				distances[neighbour] = new_cost;
+				openlist.put(neighbour, new_cost);
+			}
+		};
+
+		if (forward)
+			ForEachSuccessor(*graph_, current, relax);
+		else
+			ForEachPredecessor(*graph_, current, relax);
+	}
+}
+
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+uint32_t LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::GetVertexIndex(const StateType &state) const
+{
+	auto vertex = graph_->GetVertexFromID(GetStateID(state));
+
+	if (vertex != nullptr)
+		return vertex->vertex_index_;
+	else
+		return std::numeric_limits<uint32_t>::max();
+}
+
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+double LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::GetLowerBound(uint32_t vertex_idx, uint32_t goal_idx, const std::vector<uint32_t> &landmarks) const
+{
+	if (landmarks.empty())
+		return 0.0;
+
+	const std::size_t k = landmark_ids_.size();
+	const DistanceType *vertex_from = &distance_from_[vertex_idx * k];
+	const DistanceType *vertex_to = &distance_to_[vertex_idx * k];
+	const DistanceType *goal_from = &distance_from_[goal_idx * k];
+	const DistanceType *goal_to = &distance_to_[goal_idx * k];
+
+	// a landmark only gives a bound if it's connected to both vertices. Both stored distances
+	//	may be rounded by RoundingError in the wrong direction, the bound is reduced by the
+	//	sum of both errors to stay below the true distance.
+	double bound = 0;
+	for (auto l : landmarks)
+	{
+		if (vertex_from[l] != Unreachable && goal_from[l] != Unreachable)
+		{
+			double minuend = goal_from[l];
+			double subtrahend = vertex_from[l];
+			bound = std::max(bound, minuend - subtrahend - RoundingError * (minuend + subtrahend));
+		}
+		if (vertex_to[l] != Unreachable && goal_to[l] != Unreachable)
+		{
+			double minuend = vertex_to[l];
+			double subtrahend = goal_to[l];
+			bound = std::max(bound, minuend - subtrahend - RoundingError * (minuend + subtrahend));
+		}
+	}
+
+	return bound;
+}
+
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+typename LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::Heuristic LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::GetHeuristic() const
+{
+	std::vector<uint32_t> landmarks(landmark_ids_.size());
+	for (uint32_t l = 0; l < landmarks.size(); ++l)
+		landmarks[l] = l;
+
+	return Heuristic(this, std::move(landmarks));
+}
+
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+typename LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::Heuristic LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::GetHeuristic(std::vector<uint32_t> landmarks) const
+{
+	return Heuristic(this, std::move(landmarks));
+}
+
+template <typename StateType, typename TransitionType, typename DistanceType, typename IDIndexType>
+typename LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::Heuristic LandmarkTable_t<StateType, TransitionType, DistanceType, IDIndexType>::GetHeuristic(uint64_t start_id, uint64_t goal_id, std::size_t active_num) const
+{
+	auto start = graph_->GetVertexFromID(start_id);
+	auto goal = graph_->GetVertexFromID(goal_id);
+	if (start == nullptr || goal == nullptr || active_num >= landmark_ids_.size())
+		return GetHeuristic();
+
+	// rank the landmarks by the bound they give between start and goal
+	std::vector<std::pair<double, uint32_t>> bounds;
+	for (uint32_t l = 0; l < landmark_ids_.size(); ++l)
+		bounds.emplace_back(GetLowerBound(start->vertex_index_, goal->vertex_index_, std::vector<uint32_t>(1, l)), l);
+	std::partial_sort(bounds.begin(), bounds.begin() + active_num, bounds.end(),
+					  [](const std::pair<double, uint32_t> &a, const std::pair<double, uint32_t> &b) { return a.first > b.first; });
+
+	std::vector<uint32_t> landmarks;
+	for (std::size_t i = 0; i < active_num; ++i)
+		landmarks.push_back(bounds[i].second);
+
+	return Heuristic(this, std::move(landmarks));
+}
+}
+
+#endif /* LANDMARK_TABLE_IMPL_HPP */
@@ -0,0 +1,106 @@
+/*
+ * lazy_graph_impl.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef LAZY_GRAPH_IMPL_HPP
+#define LAZY_GRAPH_IMPL_HPP
+
+#include <algorithm>
+#include <utility>
+
+namespace librav
+{
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void LazyGraph_t<StateType, TransitionType, IDIndexType>::BeginQuery()
+{
+	++query_count_;
+
+	if (max_vertex_num_ > 0 && graph_.GetVertexNumber() > max_vertex_num_)
+		Evict(max_vertex_num_ / 2);
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+typename LazyGraph_t<StateType, TransitionType, IDIndexType>::VertexType *LazyGraph_t<StateType, TransitionType, IDIndexType>::GetVertex(StateType state)
+{
+	VertexType *vertex = graph_.GetVertexFromID(GetStateID(state));
+
+	if (vertex == nullptr)
+		vertex = graph_.AddVertex(state);
+	Touch(vertex);
+
+	return vertex;
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void LazyGraph_t<StateType, TransitionType, IDIndexType>::ExpandVertex(VertexType *vertex)
+{
+	Touch(vertex);
+	if (expanded_[vertex->vertex_index_])
+		return;
+
+	for (auto &neighbour : get_neighbours_(vertex->state_))
+		graph_.AddEdge(vertex->state_, std::get<0>(neighbour), std::get<1>(neighbour));
+	expanded_[vertex->vertex_index_] = true;
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void LazyGraph_t<StateType, TransitionType, IDIndexType>::Clear()
+{
+	graph_.ClearGraph();
+	expanded_.clear();
+	last_used_.clear();
+}
+
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void LazyGraph_t<StateType, TransitionType, IDIndexType>::Touch(VertexType *vertex)
+{
+	// vertices created by an expansion get their entries here
+	if (expanded_.size() < graph_.GetVertexIndexBound())
+	{
+		expanded_.resize(graph_.GetVertexIndexBound(), false);
+		last_used_.resize(graph_.GetVertexIndexBound(), 0);
+	}
+
+	last_used_[vertex->vertex_index_] = query_count_;
+}
+
+/// Remove the least recently used vertices until vertex_num vertices are left
+template <typename StateType, typename TransitionType, typename IDIndexType>
+void LazyGraph_t<StateType, TransitionType, IDIndexType>::Evict(std::size_t vertex_num)
+{
+	// vertices created by an expansion but never touched count as least recently used
+	expanded_.resize(graph_.GetVertexIndexBound(), false);
+	last_used_.resize(graph_.GetVertexIndexBound(), 0);
+
+	std::vector<std::pair<uint32_t, uint32_t>> candidates;
+	for (uint32_t i = 0; i < graph_.GetVertexIndexBound(); ++i)
+	{
+		if (graph_.GetVertexFromIndex(i) != nullptr)
+			candidates.emplace_back(last_used_[i], i);
+	}
+
+	std::size_t evict_num = candidates.size() - std::min(vertex_num, candidates.size());
+	std::nth_element(candidates.begin(), candidates.begin() + evict_num, candidates.end());
+
+	for (std::size_t i = 0; i < evict_num; ++i)
+	{
+		VertexType *vertex = graph_.GetVertexFromIndex(candidates[i].second);
+
+		// the successor lists of the predecessors become incomplete
+		for (auto &edge : vertex->edges_from_)
+			expanded_[edge.src_->vertex_index_] = false;
+		expanded_[vertex->vertex_index_] = false;
+
+		StateType state = vertex->state_;
+		graph_.RemoveVertex(state);
+	}
+}
+}
+
+#endif /* LAZY_GRAPH_IMPL_HPP */
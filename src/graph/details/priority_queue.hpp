@@ -11,31 +11,39 @@
 #define PRIORITY_QUEUE_HPP
 
 #include <utility>
-#include <queue>
+#include <vector>
+#include <algorithm>
+#include <functional>
 
 namespace librav
 {
 
-/// A simple priority queue structure used as A* open list.
+/// A simple priority queue structure used as A* open list. The heap is kept in a vector, so
+///	clear() empties the queue without giving its memory back.
 // Source: http://www.redblobgames.com/pathfinding/a-star/implementation.html
 template<typename T, typename Number=double>
 struct PriorityQueue {
 	typedef std::pair<Number, T> PQElement;
 
-	std::priority_queue<PQElement, std::vector<PQElement>,
-	std::greater<PQElement>> elements;
+	std::vector<PQElement> elements;
 
 	inline bool empty() const { return elements.empty(); }
 
+	inline std::size_t size() const { return elements.size(); }
+
 	inline void put(T item, Number priority) {
-		elements.emplace(priority, item);
+		elements.emplace_back(priority, item);
+		std::push_heap(elements.begin(), elements.end(), std::greater<PQElement>());
 	}
 
 	inline T get() {
-		T best_item = elements.top().second;
-		elements.pop();
+		std::pop_heap(elements.begin(), elements.end(), std::greater<PQElement>());
+		T best_item = elements.back().second;
+		elements.pop_back();
 		return best_item;
 	}
+
+	inline void clear() { elements.clear(); }
 };
 
 }
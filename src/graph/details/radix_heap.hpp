@@ -0,0 +1,131 @@
+/*
+ * radix_heap.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: monotone radix heap
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+namespace librav
+{
+
+/// A monotone radix heap that can be used as A* open list.
+///
+/// The keys popped from a radix heap never decrease, which holds for Dijkstra's algorithm
+///	and A* with a consistent heuristic. Non-negative integer and floating-point priorities
+///	are supported: a non-negative IEEE-754 number keeps its order when its bits are read
+///	as an unsigned integer. A priority lower than the last popped one is clamped to it.
+///
+/// Like PriorityQueue there is no decrease-key, an improved vertex is simply put again and
+///	the stale entry is skipped by the search. Each entry is moved between buckets at most
+///	once per bit of the key, so push and pop are O(1) amortized for bounded key width.
+template <typename Number = double>
+class RadixHeap
+{
+	static_assert(std::is_arithmetic<Number>::value, "RadixHeap requires an arithmetic priority type");
+
+  public:
+	RadixHeap() : buckets_(65), last_(0), size_(0) {}
+
+	inline bool empty() const { return size_ == 0; }
+
+	inline std::size_t size() const { return size_; }
+
+	inline void put(uint32_t item, Number priority)
+	{
+		uint64_t key = ToKey(priority);
+		if (key < last_)
+			key = last_;
+		buckets_[BucketIndex(key)].emplace_back(key, item);
+		++size_;
+	}
+
+	inline uint32_t get()
+	{
+		if (buckets_[0].empty())
+		{
+			// find the first non-empty bucket and redistribute it around its minimum
+			std::size_t idx = 1;
+			while (buckets_[idx].empty())
+				++idx;
+
+			uint64_t new_last = buckets_[idx].front().first;
+			for (const auto &entry : buckets_[idx])
+				if (entry.first < new_last)
+					new_last = entry.first;
+			last_ = new_last;
+
+			for (const auto &entry : buckets_[idx])
+				buckets_[BucketIndex(entry.first)].push_back(entry);
+			buckets_[idx].clear();
+		}
+
+		uint32_t best_item = buckets_[0].back().second;
+		buckets_[0].pop_back();
+		--size_;
+		return best_item;
+	}
+
+	inline void clear()
+	{
+		for (auto &bucket : buckets_)
+			bucket.clear();
+		last_ = 0;
+		size_ = 0;
+	}
+
+  private:
+	std::vector<std::vector<std::pair<uint64_t, uint32_t>>> buckets_;
+	uint64_t last_;
+	std::size_t size_;
+
+	// bucket 0 holds keys equal to last_, bucket i holds keys whose highest bit
+	//	differing from last_ is bit i-1
+	inline std::size_t BucketIndex(uint64_t key) const
+	{
+		uint64_t diff = key ^ last_;
+#if defined(__GNUC__) || defined(__clang__)
+		return diff == 0 ? 0 : 64 - __builtin_clzll(diff);
+#else
+		std::size_t idx = 0;
+		while (diff != 0)
+		{
+			++idx;
+			diff >>= 1;
+		}
+		return idx;
+#endif
+	}
+
+	template <typename T = Number, typename std::enable_if<std::is_floating_point<T>::value>::type * = nullptr>
+	static inline uint64_t ToKey(T priority)
+	{
+		// negative values and -0.0 are mapped to zero
+		if (!(priority > 0))
+			return 0;
+		double value = static_cast<double>(priority);
+		uint64_t key;
+		std::memcpy(&key, &value, sizeof(key));
+		return key;
+	}
+
+	template <typename T = Number, typename std::enable_if<!std::is_floating_point<T>::value>::type * = nullptr>
+	static inline uint64_t ToKey(T priority)
+	{
+		return priority > 0 ? static_cast<uint64_t>(priority) : 0;
+	}
+};
+}
+
+#endif /* RADIX_HEAP_HPP */
@@ -0,0 +1,335 @@
+/*
+ * search_metrics_impl.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef SEARCH_METRICS_IMPL_HPP
+#define SEARCH_METRICS_IMPL_HPP
+
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <fstream>
+
+namespace librav
+{
+
+/****************************************************************************/
+/*								 Histogram									*/
+/****************************************************************************/
+inline uint32_t MetricHistogram::GetBucketIndex(uint64_t value)
+{
+	if (value > MaxValue)
+		value = MaxValue;
+	if (value < SubBucketNum)
+		return static_cast<uint32_t>(value);
+
+	// keep the SubBucketBits + 1 highest bits of the value, the buckets of the values with
+	//	the highest bit at position SubBucketBits + shift start at SubBucketNum * (shift + 1)
+	uint32_t shift = 0;
+	while ((value >> shift) >= 2 * SubBucketNum)
+		++shift;
+	return static_cast<uint32_t>(SubBucketNum * shift + (value >> shift));
+}
+
+inline uint64_t MetricHistogram::GetBucketUpperBound(uint32_t index)
+{
+	if (index < SubBucketNum)
+		return index;
+
+	uint32_t shift = index / SubBucketNum - 1;
+	uint64_t top = index - SubBucketNum * shift;
+	return ((top + 1) << shift) - 1;
+}
+
+inline void MetricHistogram::Record(uint64_t value, uint64_t count)
+{
+	if (value > MaxValue)
+		value = MaxValue;
+
+	buckets_[GetBucketIndex(value)] += count;
+	count_ += count;
+	sum_ += value * count;
+	if (value > max_)
+		max_ = value;
+}
+
+inline void MetricHistogram::Merge(const MetricHistogram &other)
+{
+	for (uint32_t i = 0; i < BucketNum; ++i)
+		buckets_[i] += other.buckets_[i];
+	count_ += other.count_;
+	sum_ += other.sum_;
+	if (other.max_ > max_)
+		max_ = other.max_;
+}
+
+inline void MetricHistogram::Clear()
+{
+	std::fill(buckets_.begin(), buckets_.end(), 0);
+	count_ = 0;
+	sum_ = 0;
+	max_ = 0;
+}
+
+inline uint64_t MetricHistogram::GetValueAtPercentile(double percentile) const
+{
+	if (count_ == 0)
+		return 0;
+
+	percentile = std::max(0.0, std::min(100.0, percentile));
+	uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * count_));
+	if (rank == 0)
+		rank = 1;
+
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < BucketNum; ++i)
+	{
+		seen += buckets_[i];
+		if (seen >= rank)
+			return std::min(GetBucketUpperBound(i), max_);
+	}
+	return max_;
+}
+
+/****************************************************************************/
+/*							 Per-thread storage								*/
+/****************************************************************************/
+inline void SearchMetrics::AddRelaxed(std::atomic<uint64_t> &counter, uint64_t value)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+inline SearchMetrics::AtomicHistogram::AtomicHistogram()
+{
+	Clear();
+}
+
+inline void SearchMetrics::AtomicHistogram::Record(uint64_t value)
+{
+	if (value > MetricHistogram::MaxValue)
+		value = MetricHistogram::MaxValue;
+
+	AddRelaxed(buckets_[MetricHistogram::GetBucketIndex(value)], 1);
+	AddRelaxed(count_, 1);
+	AddRelaxed(sum_, value);
+	if (value > max_.load(std::memory_order_relaxed))
+		max_.store(value, std::memory_order_relaxed);
+}
+
+inline void SearchMetrics::AtomicHistogram::MergeInto(MetricHistogram &histogram) const
+{
+	// the total is summed from the buckets, so it stays consistent with them even if a
+	//	value is recorded while merging
+	uint64_t count = 0;
+	for (uint32_t i = 0; i < MetricHistogram::BucketNum; ++i)
+	{
+		uint64_t bucket = buckets_[i].load(std::memory_order_relaxed);
+		histogram.buckets_[i] += bucket;
+		count += bucket;
+	}
+	histogram.count_ += count;
+	histogram.sum_ += sum_.load(std::memory_order_relaxed);
+	histogram.max_ = std::max(histogram.max_, max_.load(std::memory_order_relaxed));
+}
+
+inline void SearchMetrics::AtomicHistogram::Clear()
+{
+	for (auto &bucket : buckets_)
+		bucket.store(0, std::memory_order_relaxed);
+	count_.store(0, std::memory_order_relaxed);
+	sum_.store(0, std::memory_order_relaxed);
+	max_.store(0, std::memory_order_relaxed);
+}
+
+inline SearchMetrics::Shard::Shard()
+{
+	for (auto &engine : engines_)
+		engine.store(nullptr, std::memory_order_relaxed);
+}
+
+inline SearchMetrics::Shard::~Shard()
+{
+	for (auto &engine : engines_)
+		delete engine.load(std::memory_order_relaxed);
+}
+
+inline SearchMetrics::EngineSlot *SearchMetrics::Shard::GetEngine(const char *algorithm)
+{
+	for (auto &engine : engines_)
+	{
+		EngineSlot *slot = engine.load(std::memory_order_relaxed);
+		if (slot == nullptr)
+		{
+			// publish the slot after it's constructed, readers load it with acquire
+			slot = new EngineSlot(algorithm);
+			engine.store(slot, std::memory_order_release);
+			return slot;
+		}
+		if (slot->algorithm_ == algorithm || std::strcmp(slot->algorithm_, algorithm) == 0)
+			return slot;
+	}
+	return nullptr;
+}
+
+/****************************************************************************/
+/*								 Registry									*/
+/****************************************************************************/
+inline SearchMetrics::ShardOwner::~ShardOwner()
+{
+	// the mutex orders the last updates of this thread before those of the next owner
+	if (shard_ != nullptr)
+	{
+		std::lock_guard<std::mutex> lock(metrics_->shards_mutex_);
+		metrics_->free_shards_.push_back(shard_);
+	}
+}
+
+inline SearchMetrics::Shard *SearchMetrics::GetThreadShard()
+{
+	// there is only one registry, see GetSearchMetrics(), so a shard per thread is enough
+	static thread_local ShardOwner owner;
+	if (owner.shard_ == nullptr)
+	{
+		std::lock_guard<std::mutex> lock(shards_mutex_);
+		if (free_shards_.empty())
+		{
+			shards_.emplace_back(new Shard());
+			owner.shard_ = shards_.back().get();
+		}
+		else
+		{
+			owner.shard_ = free_shards_.back();
+			free_shards_.pop_back();
+		}
+		owner.metrics_ = this;
+	}
+	return owner.shard_;
+}
+
+inline void SearchMetrics::Record(const char *algorithm, bool found, const SearchStatistics &statistics)
+{
+	EngineSlot *engine = GetThreadShard()->GetEngine(algorithm);
+	if (engine == nullptr)
+		return;
+
+	AddRelaxed(engine->query_num_, 1);
+	if (found)
+		AddRelaxed(engine->found_num_, 1);
+	engine->latency_.Record(static_cast<uint64_t>(statistics.search_time_ * 1e9));
+	engine->expanded_num_.Record(statistics.expanded_num_);
+	engine->max_openlist_size_.Record(statistics.max_openlist_size_);
+}
+
+inline std::vector<SearchEngineMetrics> SearchMetrics::GetSnapshot() const
+{
+	std::vector<SearchEngineMetrics> snapshot;
+
+	std::lock_guard<std::mutex> lock(shards_mutex_);
+	for (const auto &shard : shards_)
+	{
+		for (const auto &engine : shard->engines_)
+		{
+			const EngineSlot *slot = engine.load(std::memory_order_acquire);
+			if (slot == nullptr)
+				break;
+
+			auto metrics = std::find_if(snapshot.begin(), snapshot.end(), [slot](const SearchEngineMetrics &m) {
+				return m.algorithm_ == slot->algorithm_;
+			});
+			if (metrics == snapshot.end())
+			{
+				snapshot.emplace_back();
+				snapshot.back().algorithm_ = slot->algorithm_;
+				metrics = snapshot.end() - 1;
+			}
+
+			metrics->query_num_ += slot->query_num_.load(std::memory_order_relaxed);
+			metrics->found_num_ += slot->found_num_.load(std::memory_order_relaxed);
+			slot->latency_.MergeInto(metrics->latency_);
+			slot->expanded_num_.MergeInto(metrics->expanded_num_);
+			slot->max_openlist_size_.MergeInto(metrics->max_openlist_size_);
+		}
+	}
+
+	std::sort(snapshot.begin(), snapshot.end(), [](const SearchEngineMetrics &m1, const SearchEngineMetrics &m2) {
+		return m1.algorithm_ < m2.algorithm_;
+	});
+	return snapshot;
+}
+
+inline void SearchMetrics::Export(const std::function<void(const SearchEngineMetrics &)> &callback) const
+{
+	for (const auto &metrics : GetSnapshot())
+		callback(metrics);
+}
+
+inline void SearchMetrics::WriteSnapshot(std::ostream &os) const
+{
+	auto write_histogram = [&os](const char *name, const MetricHistogram &histogram, double scale) {
+		os << "  " << name << ": mean " << histogram.GetMean() * scale
+		   << ", p50 " << histogram.GetValueAtPercentile(50) * scale
+		   << ", p99 " << histogram.GetValueAtPercentile(99) * scale
+		   << ", p999 " << histogram.GetValueAtPercentile(99.9) * scale
+		   << ", max " << histogram.GetMax() * scale << "\n";
+	};
+
+	for (const auto &metrics : GetSnapshot())
+	{
+		os << metrics.algorithm_ << ": queries " << metrics.query_num_ << ", found " << metrics.found_num_ << "\n";
+		write_histogram("latency (us)", metrics.latency_, 1e-3);
+		write_histogram("expanded vertices", metrics.expanded_num_, 1);
+		write_histogram("peak open list size", metrics.max_openlist_size_, 1);
+	}
+}
+
+inline bool SearchMetrics::WriteSnapshot(const std::string &filename) const
+{
+	std::ofstream file(filename);
+	if (!file)
+		return false;
+
+	WriteSnapshot(file);
+	return static_cast<bool>(file);
+}
+
+inline void SearchMetrics::Clear()
+{
+	std::lock_guard<std::mutex> lock(shards_mutex_);
+	for (const auto &shard : shards_)
+	{
+		for (const auto &engine : shard->engines_)
+		{
+			EngineSlot *slot = engine.load(std::memory_order_acquire);
+			if (slot == nullptr)
+				break;
+
+			slot->query_num_.store(0, std::memory_order_relaxed);
+			slot->found_num_.store(0, std::memory_order_relaxed);
+			slot->latency_.Clear();
+			slot->expanded_num_.Clear();
+			slot->max_openlist_size_.Clear();
+		}
+	}
+}
+
+inline std::size_t SearchMetrics::GetShardNumber() const
+{
+	std::lock_guard<std::mutex> lock(shards_mutex_);
+	return shards_.size();
+}
+
+inline SearchMetrics &GetSearchMetrics()
+{
+	// never destroyed: the shards of threads that exit during or after the destruction of
+	//	static objects, including the main thread, are still returned to it
+	static SearchMetrics *metrics = new SearchMetrics();
+	return *metrics;
+}
+}
+
+#endif /* SEARCH_METRICS_IMPL_HPP */
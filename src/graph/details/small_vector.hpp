@@ -0,0 +1,197 @@
+/*
+ * small_vector.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: vector with inline storage for a few elements
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+namespace librav
+{
+
+/// A vector that keeps up to InlineNum elements inside the object itself and only allocates
+///	memory from Allocator when it grows beyond that. It's used for the edge lists of Vertex_t,
+///	which hold only a few edges for most vertices of grids and lattices.
+///
+/// Only the operations needed by the graph are provided. Like std::vector, iterators and
+///	references are invalidated when the vector grows, and also when it's moved.
+template <typename T, std::size_t InlineNum, typename Allocator = std::allocator<T>>
+class SmallVector
+{
+  public:
+	typedef T value_type;
+	typedef T *iterator;
+	typedef const T *const_iterator;
+
+	explicit SmallVector(const Allocator &allocator = Allocator()) : allocator_(allocator) {}
+
+	SmallVector(const SmallVector &other) : allocator_(other.allocator_)
+	{
+		reserve(other.size_);
+		for (const auto &element : other)
+			push_back(element);
+	}
+
+	SmallVector &operator=(const SmallVector &other)
+	{
+		if (this != &other)
+		{
+			clear();
+			reserve(other.size_);
+			for (const auto &element : other)
+				push_back(element);
+		}
+		return *this;
+	}
+
+	/// A heap buffer is taken over by the new vector, inline elements are moved one by one
+	SmallVector(SmallVector &&other) : allocator_(other.allocator_)
+	{
+		TakeFrom(other);
+	}
+
+	SmallVector &operator=(SmallVector &&other)
+	{
+		if (this != &other)
+		{
+			Release();
+			allocator_ = other.allocator_;
+			TakeFrom(other);
+		}
+		return *this;
+	}
+
+	~SmallVector()
+	{
+		Release();
+	}
+
+	inline bool empty() const { return size_ == 0; }
+	inline std::size_t size() const { return size_; }
+	inline std::size_t capacity() const { return capacity_; }
+
+	inline iterator begin() { return data_; }
+	inline iterator end() { return data_ + size_; }
+	inline const_iterator begin() const { return data_; }
+	inline const_iterator end() const { return data_ + size_; }
+
+	inline T &operator[](std::size_t pos) { return data_[pos]; }
+	inline const T &operator[](std::size_t pos) const { return data_[pos]; }
+
+	inline T &front() { return data_[0]; }
+	inline const T &front() const { return data_[0]; }
+	inline T &back() { return data_[size_ - 1]; }
+	inline const T &back() const { return data_[size_ - 1]; }
+
+	void push_back(const T &element) { emplace_back(element); }
+
+	/// The arguments may refer to an element of the vector itself, e.g. v.push_back(v[0])
+	template <typename... Args>
+	void emplace_back(Args &&... args)
+	{
+		if (size_ == capacity_)
+		{
+			// construct the new element before the old ones are moved out of the way
+			std::size_t capacity = capacity_ > 0 ? capacity_ * 2 : 1;
+			T *data = allocator_.allocate(capacity);
+			new (data + size_) T(std::forward<Args>(args)...);
+			MoveTo(data, capacity);
+		}
+		else
+			new (data_ + size_) T(std::forward<Args>(args)...);
+		++size_;
+	}
+
+	void pop_back()
+	{
+		--size_;
+		data_[size_].~T();
+	}
+
+	/// Remove all elements, the memory is kept
+	void clear()
+	{
+		for (std::size_t i = 0; i < size_; ++i)
+			data_[i].~T();
+		size_ = 0;
+	}
+
+	void reserve(std::size_t capacity)
+	{
+		if (capacity > capacity_)
+			Grow(capacity);
+	}
+
+  private:
+	T *data_ = reinterpret_cast<T *>(&inline_storage_);
+	uint32_t size_ = 0;
+	uint32_t capacity_ = InlineNum;
+	Allocator allocator_;
+	typename std::aligned_storage<sizeof(T) * (InlineNum > 0 ? InlineNum : 1), alignof(T)>::type inline_storage_;
+
+	inline bool IsInline() const { return data_ == reinterpret_cast<const T *>(&inline_storage_); }
+
+	void Grow(std::size_t capacity)
+	{
+		MoveTo(allocator_.allocate(capacity), capacity);
+	}
+
+	// move the elements into a new buffer of the given capacity and free the old one
+	void MoveTo(T *data, std::size_t capacity)
+	{
+		for (std::size_t i = 0; i < size_; ++i)
+		{
+			new (data + i) T(std::move(data_[i]));
+			data_[i].~T();
+		}
+		if (!IsInline())
+			allocator_.deallocate(data_, capacity_);
+
+		data_ = data;
+		capacity_ = static_cast<uint32_t>(capacity);
+	}
+
+	// destroy the elements and free the heap buffer, the vector must be reset afterwards
+	void Release()
+	{
+		clear();
+		if (!IsInline())
+			allocator_.deallocate(data_, capacity_);
+	}
+
+	// take the elements of other, which is left empty with its inline storage
+	void TakeFrom(SmallVector &other)
+	{
+		if (other.IsInline())
+		{
+			data_ = reinterpret_cast<T *>(&inline_storage_);
+			capacity_ = InlineNum;
+			for (std::size_t i = 0; i < other.size_; ++i)
+				new (data_ + i) T(std::move(other.data_[i]));
+			size_ = other.size_;
+			other.clear();
+		}
+		else
+		{
+			data_ = other.data_;
+			size_ = other.size_;
+			capacity_ = other.capacity_;
+			other.data_ = reinterpret_cast<T *>(&other.inline_storage_);
+			other.size_ = 0;
+			other.capacity_ = InlineNum;
+		}
+	}
+};
+}
+
+#endif /* SMALL_VECTOR_HPP */
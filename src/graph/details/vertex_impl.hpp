@@ -11,6 +11,7 @@
 #define VERTEX_IMPL_HPP
 
 #include <cstdint>
+#include <limits>
 #include <algorithm>
 
 #include "graph/details/edge_impl.hpp"
@@ -24,34 +25,21 @@ namespace librav
 /// A vertex data structure template.
 template <typename StateType, typename TransitionType>
 template <class T, typename std::enable_if<std::is_pointer<T>::value>::type *>
-Vertex_t<StateType,TransitionType>::Vertex_t(T state) : // attributes related to associated node
-												state_(state), vertex_id_(state->GetUniqueID()),
-												// common attributes
-												search_parent_(nullptr),
-												is_checked_(false), is_in_openlist_(false),
-												f_astar_(0), g_astar_(0), h_astar_(0){};
+Vertex_t<StateType,TransitionType>::Vertex_t(StateType state, GraphArena *arena) : // common attributes
+												vertex_index_(0),
+												edges_to_(ArenaAllocator<OutEdgeType>(arena)),
+												vertex_id_(state->GetUniqueID()),
+												edges_from_(ArenaAllocator<InEdgeType>(arena)),
+												state_(state){};
 
 template <typename StateType, typename TransitionType>
 template <class T, typename std::enable_if<!std::is_pointer<T>::value>::type *>
-Vertex_t<StateType,TransitionType>::Vertex_t(T state) : // attributes related to associated node
-												state_(state), vertex_id_(state.GetUniqueID()),
-												// common attributes
-												search_parent_(nullptr),
-												is_checked_(false), is_in_openlist_(false),
-												f_astar_(0), g_astar_(0), h_astar_(0){};
-
-/// Clear exiting search info before a new search
-template <typename StateType, typename TransitionType>
-void Vertex_t<StateType,TransitionType>::ClearVertexSearchInfo()
-{
-	is_checked_ = false;
-	is_in_openlist_ = false;
-	search_parent_ = nullptr;
-
-	f_astar_ = 0.0;
-	g_astar_ = 0.0;
-	h_astar_ = 0.0;
-}
+Vertex_t<StateType,TransitionType>::Vertex_t(StateType state, GraphArena *arena) : // common attributes
+												vertex_index_(0),
+												edges_to_(ArenaAllocator<OutEdgeType>(arena)),
+												vertex_id_(state.GetUniqueID()),
+												edges_from_(ArenaAllocator<InEdgeType>(arena)),
+												state_(state){};
 
 /// == operator overloading. If two vertices have the same id, they're regarded as equal.
 template <typename StateType, typename TransitionType>
@@ -63,16 +51,17 @@ bool Vertex_t<StateType,TransitionType>::operator==(const Vertex_t<StateType,Tra
 		return false;
 }
 
-/// Get edge cost from current vertex to given vertex. -1 is returned if no edge between
-///		the two vertices exists.
+/// Get edge cost from current vertex to given vertex. Infinity (or the largest value of
+///		TransitionType if it has no infinity) is returned if no edge between the two
+///		vertices exists.
 template <typename StateType, typename TransitionType>
 TransitionType Vertex_t<StateType,TransitionType>::GetEdgeCost(const Vertex_t<StateType,TransitionType> &dst_node) const
 {
-	TransitionType cost;
+	TransitionType cost = std::numeric_limits<TransitionType>::has_infinity ? std::numeric_limits<TransitionType>::infinity() : std::numeric_limits<TransitionType>::max();
 
 	for (const auto &it : edges_to_)
 	{
-		if (it.dst_.vertex_id_ == dst_node.vertex_id_)
+		if (it.dst_->vertex_id_ == dst_node.vertex_id_)
 		{
 			cost = it.cost_;
 			break;
@@ -98,14 +87,7 @@ std::vector<Vertex_t<StateType,TransitionType> *> Vertex_t<StateType,TransitionT
 template <typename StateType, typename TransitionType>
 bool Vertex_t<StateType,TransitionType>::CheckNeighbour(Vertex_t<StateType,TransitionType> *dst_node)
 {
-	std::vector<Vertex_t<StateType,TransitionType> *> neighbours = GetNeighbours();
-
-	auto it = find(neighbours.begin(), neighbours.end(), dst_node);
-
-	if (it != neighbours.end())
-		return true;
-	else
-		return false;
+	return std::any_of(edges_to_.begin(), edges_to_.end(), [dst_node](const OutEdgeType &edge) { return edge.dst_ == dst_node; });
 }
 }
 
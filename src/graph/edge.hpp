@@ -53,7 +53,7 @@ class Edge
 	 */
 	bool operator-=(const Edge<VertexPtrType, TransitionType> &other)
 	{
-		if ((src_->vertex_id_ == other.src_->vertex_id_ && dst_.vertex_id_ == other.dst_->vertex_id_) || (src_->vertex_id_ == other.dst_->vertex_id_ && dst_.vertex_id_ == other.src_->vertex_id_))
+		if ((src_->vertex_id_ == other.src_->vertex_id_ && dst_->vertex_id_ == other.dst_->vertex_id_) || (src_->vertex_id_ == other.dst_->vertex_id_ && dst_->vertex_id_ == other.src_->vertex_id_))
 			return true;
 		else
 			return false;
@@ -64,6 +64,28 @@ class Edge
 	 */
 	void PrintEdge() const;
 };
+
+/// An entry of the outgoing edge list of a vertex. The source is the vertex owning the list,
+///	so only the destination is stored.
+template <typename VertexPtrType, typename TransitionType>
+struct OutEdge
+{
+	OutEdge(VertexPtrType dst, TransitionType c) : dst_(dst), cost_(c){};
+
+	VertexPtrType dst_;
+	TransitionType cost_;
+};
+
+/// An entry of the incoming edge list of a vertex. The destination is the vertex owning the
+///	list, so only the source is stored.
+template <typename VertexPtrType, typename TransitionType>
+struct InEdge
+{
+	InEdge(VertexPtrType src, TransitionType c) : src_(src), cost_(c){};
+
+	VertexPtrType src_;
+	TransitionType cost_;
+};
 }
 
 #include "graph/details/edge_impl.hpp"
@@ -10,26 +10,21 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
 
-#define USE_UNORDERED_MAP
-
-#ifndef USE_UNORDERED_MAP
-#include <map>
-#else
-#include <unordered_map>
-#endif
 #include <vector>
+#include <tuple>
 #include <cstdint>
 #include <type_traits>
 
 #include "graph/edge.hpp"
 #include "graph/vertex.hpp"
 #include "graph/details/helper_func.hpp"
+#include "graph/details/id_index.hpp"
 
 namespace librav
 {
 
 // Only types ended with "_t" should be used in user applications
-template <typename StateType, typename TransitionType = double>
+template <typename StateType, typename TransitionType = double, typename IDIndexType = FlatIDIndex>
 class Graph_t;
 
 template <typename StateType, typename TransitionType>
@@ -41,8 +36,12 @@ using Edge_t = Edge<Vertex_t<StateType, TransitionType> *, TransitionType>;
 template <typename StateType, typename TransitionType>
 using Path_t = std::vector<Vertex_t<StateType, TransitionType> *>;
 
-/// A graph data structure template.
-template <typename StateType, typename TransitionType>
+template <typename StateType, typename TransitionType = double>
+class CsrGraph_t;
+
+/// A graph data structure template. IDIndexType selects the map used to find a vertex by
+///	its id, see FlatIDIndex (default), DenseIDIndex and StdIDIndex.
+template <typename StateType, typename TransitionType, typename IDIndexType>
 class Graph_t
 {
 public:
@@ -52,11 +51,13 @@ public:
   {
     typedef typename std::remove_const<typename std::remove_reference<typename std::remove_pointer<StateType>::type>::type>::type TestType;
     static_assert(HasIDGenFunc<TestType>::value, "function required in StateType: uint64_t GetUniqueID() const");
+    static_assert(alignof(VertexType) <= GraphArena::Alignment, "StateType alignment not supported by GraphArena");
   }
 
   /// Graph_t destructor. Graph_t class is only responsible for the memory recycling of Vertex_t and Edge_t
-  /// objects. The node, such as a quadtree node or a square cell, which each vertex is associated
-  ///  with needs to be recycled separately, for example by the quadtree/square_grid class.
+  /// objects, which are allocated from an arena owned by the graph and released in bulk. The node, such
+  ///  as a quadtree node or a square cell, which each vertex is associated with needs to be recycled
+  ///  separately, for example by the quadtree/square_grid class.
   ~Graph_t();
 
   typedef Vertex_t<StateType, TransitionType> VertexType;
@@ -66,19 +67,46 @@ public:
 public:
   /// This function creates a vertex in the graph that associates with the given node.
   template <class T = StateType, typename std::enable_if<std::is_pointer<T>::value>::type * = nullptr>
-  VertexType *AddVertex(T vertex_node);
+  VertexType *AddVertex(StateType vertex_node);
 
   /// This function checks if a vertex exists in the graph and remove it if presents.
   template <class T = StateType, typename std::enable_if<!std::is_pointer<T>::value>::type * = nullptr>
-  void RemoveVertex(T vertex_node);
+  void RemoveVertex(StateType vertex_node);
 
   /* Directed Graph */
   /// This function is used to create a graph by adding edges connecting two nodes
   void AddEdge(StateType src_node, StateType dst_node, TransitionType cost);
 
-  /// This function is used to remove the edge from src_node to dst_node.
+  /// This function adds a batch of (src_node, dst_node, cost) edges and returns the number of
+  ///  edges added. Edges that already exist in the graph or appear earlier in the batch are
+  ///  skipped, like with AddEdge(). Edges are added one by one while the edge lists are short.
+  ///  Once they hold more than 2 * Vertex_t::InlineEdgeNum edges on average, the rest of the
+  ///  batch is grouped by source vertex, so each edge list grows once to its final size and
+  ///  the duplicate check takes linear time instead of a scan of the edge list per edge. The
+  ///  grouping uses scratch space proportional to the number of vertices.
+  std::size_t AddEdges(const std::vector<std::tuple<StateType, StateType, TransitionType>> &edges);
+
+  /// This function is used to remove the edge from src_node to dst_node. The edge is found
+  ///  through the edge index, see BuildEdgeIndex() for the cost of the first call.
   bool RemoveEdge(StateType src_node, StateType dst_node);
 
+  /// This function changes the cost of the edge from src_node to dst_node, it returns
+  ///  false if the edge doesn't exist. The edge is found through the edge index, so the
+  ///  update takes constant time and doesn't allocate memory once the index exists. The
+  ///  first call builds the index, see BuildEdgeIndex().
+  bool UpdateEdgeCost(StateType src_node, StateType dst_node, TransitionType cost);
+
+  /// This function applies a batch of (src_node, dst_node, cost) updates and returns the
+  ///  number of edges that were found and changed
+  std::size_t UpdateEdgeCosts(const std::vector<std::tuple<StateType, StateType, TransitionType>> &updates);
+
+  /// This function builds the edge index used by UpdateEdgeCost() and RemoveEdge(). Building
+  ///  it takes O(E) time and allocates memory for all edges; it's done by the first update or
+  ///  removal unless this function is called before. Once built, the index is kept up to date
+  ///  by every edge change, so call it right after loading a graph (or on the empty graph)
+  ///  to keep that one-time cost out of latency-sensitive updates.
+  void BuildEdgeIndex();
+
   /// This functions is used to access all vertices of a graph
   std::vector<VertexType *> GetGraphVertices() const;
 
@@ -89,7 +117,8 @@ public:
   /// This function is used to create a graph by adding edges connecting two nodes
   void AddUndirectedEdge(StateType src_node, StateType dst_node, TransitionType cost);
 
-  /// This function is used to remove the edge from src_node to dst_node.
+  /// This function is used to remove the edges between src_node and dst_node, it returns
+  ///  false if there is no edge in either direction.
   bool RemoveUndirectedEdge(StateType src_node, StateType dst_node);
 
   /// This functions is used to access all edges of a graph
@@ -100,48 +129,116 @@ public:
   void ClearGraph();
 
   /// This function return the vertex with specified id
-  VertexType *GetVertexFromID(uint64_t vertex_id);
+  VertexType *GetVertexFromID(uint64_t vertex_id) const;
+
+  /// This function return the vertex with specified dense index, nullptr is returned
+  ///  if no vertex is currently associated with the index
+  VertexType *GetVertexFromIndex(uint32_t vertex_index) const;
+
+  /// This function declares that the ids of the vertices are smaller than id_bound. With
+  ///  DenseIDIndex the id table is allocated once for the whole range, other indices reserve
+  ///  room for id_bound vertices. DenseIDIndex throws std::out_of_range for ids above
+  ///  DenseIDMap::MaxID, here and when a vertex with such an id is added.
+  void ReserveIDRange(uint64_t id_bound) { vertex_map_.reserve(id_bound); }
+
+  /// This function makes room for the given total number of vertices and edges, so that
+  ///  loading a graph of known size doesn't grow the vertex tables repeatedly
+  void Reserve(std::size_t vertex_num, std::size_t edge_num);
+
+  /// This function returns the number of vertices in the graph
+  std::size_t GetVertexNumber() const { return vertex_map_.size(); }
+
+  /// This function returns the bytes of memory allocated by the graph: the arena of the
+  ///  vertices and edge lists, the id index, the vertex table and the edge index. The memory
+  ///  of nodes that vertices point to isn't included.
+  std::size_t GetMemorySize() const;
+
+  /// All vertex indices of the graph are smaller than the returned value. It's used to size
+  ///  per-query search information, such as a SearchContext.
+  std::size_t GetVertexIndexBound() const { return vertex_table_.size(); }
+
+  /// This function creates an immutable compressed-sparse-row snapshot of the graph
+  CsrGraph_t<StateType, TransitionType> Freeze() const;
 
 public:
   /* Same functions for pointer type State node */
   template <class T = StateType, typename std::enable_if<!std::is_pointer<T>::value>::type * = nullptr>
-  VertexType *AddVertex(T vertex_node);
+  VertexType *AddVertex(StateType vertex_node);
 
   template <class T = StateType, typename std::enable_if<std::is_pointer<T>::value>::type * = nullptr>
-  void RemoveVertex(T vertex_node);
+  void RemoveVertex(StateType vertex_node);
 
 private:
-#ifndef USE_UNORDERED_MAP
-  std::map<uint64_t, VertexType *> vertex_map_;
-#else
-  std::unordered_map<uint64_t, VertexType *> vertex_map_;
-#endif
+  // vertices indexed by their id
+  typename IDIndexType::template MapType<VertexType *> vertex_map_;
+
+  // vertices indexed by their dense index, freed indices are recycled
+  std::vector<VertexType *> vertex_table_;
+  std::vector<uint32_t> free_indices_;
+
+  // position of an edge in the successor list of its source and in the predecessor list of
+  //  its destination, keyed by the dense indices of the two vertices (see GetEdgeKey()).
+  //  The index is only built when an edge is first updated or removed, or by an explicit
+  //  BuildEdgeIndex(), so constructing a graph with AddEdge() doesn't pay for it otherwise.
+  struct EdgeSlot
+  {
+    uint32_t to_pos_;
+    uint32_t from_pos_;
+  };
+  FlatIDMap<EdgeSlot> edge_index_;
+  bool edge_index_built_ = false;
+
+  static uint64_t GetEdgeKey(const VertexType *src, const VertexType *dst) { return (static_cast<uint64_t>(src->vertex_index_) << 32) | dst->vertex_index_; }
+
+  // memory of the vertices and their edge lists
+  GraphArena arena_;
+
+  /// This function assigns a dense index to a newly created vertex
+  void AssignVertexIndex(VertexType *vertex);
+
+  /// This function constructs a vertex in memory taken from the arena
+  VertexType *CreateVertex(StateType vertex_node);
+
+  /// This function creates a vertex and registers it, nothing is kept if that throws
+  VertexType *InsertVertex(StateType vertex_node);
+
+  /// This function destroys a vertex, its memory is reused by the next vertex created
+  void DestroyVertex(VertexType *vertex);
+
+  /// This function destroys all vertices and returns their memory in bulk
+  void ReleaseVertices();
+
+  /// This function updates both copies of the edge from src to dst
+  bool SetEdgeCost(VertexType *src, VertexType *dst, TransitionType cost);
 
-  friend class AStar;
+  /// This function removes the edge from src to dst. The last edge of each list is moved
+  ///  into the freed slot, so the order of the remaining edges may change.
+  bool EraseEdge(VertexType *src, VertexType *dst);
 
-  /// This function is used to reset states of all vertice for a new search
-  void ResetGraphVertices();
+  /// This function adds the edge from src to dst, it returns false if the edge exists
+  bool InsertEdge(VertexType *src, VertexType *dst, TransitionType cost);
 
   /// This function checks if a vertex already exists in the graph.
   ///	If yes, the functions returns the pointer of the existing vertex,
   ///	otherwise it creates a new vertex.
   template <class T = StateType, typename std::enable_if<!std::is_pointer<T>::value>::type * = nullptr>
-  VertexType *GetVertex(T vertex_node);
+  VertexType *GetVertex(StateType vertex_node);
 
   template <class T = StateType, typename std::enable_if<std::is_pointer<T>::value>::type * = nullptr>
-  VertexType *GetVertex(T vertex_node);
+  VertexType *GetVertex(StateType vertex_node);
 
   /// This function checks if a vertex exists in the graph.
   ///	If yes, the functions returns the pointer of the existing vertex,
   ///	otherwise it returns nullptr.
   template <class T = StateType, typename std::enable_if<!std::is_pointer<T>::value>::type * = nullptr>
-  VertexType *SearchVertex(T vertex_node);
+  VertexType *SearchVertex(StateType vertex_node);
 
   template <class T = StateType, typename std::enable_if<std::is_pointer<T>::value>::type * = nullptr>
-  VertexType *SearchVertex(T vertex_node);
+  VertexType *SearchVertex(StateType vertex_node);
 };
 }
 
 #include "graph/details/graph_impl.hpp"
+#include "graph/csr_graph.hpp"
 
 #endif /* GRAPH_HPP */
@@ -0,0 +1,42 @@
+/*
+ * graph_builder.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: build a graph from a neighbour generator using several threads
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef GRAPH_BUILDER_HPP
+#define GRAPH_BUILDER_HPP
+
+#include <vector>
+#include <thread>
+#include <cstdint>
+
+#include "graph/graph.hpp"
+
+namespace librav
+{
+
+/// Add the edges from each of the given states to the successors generated for it. The generator
+///	has the signature of GetNeighbourFunc_t: it's called with a state and returns a vector of
+///	(successor, cost) tuples. It's called concurrently from up to thread_num threads, so it must
+///	not modify shared data without synchronization.
+///
+/// The threads take chunks of states from a shared counter and store the successors of each
+///	state in a slot of its own, so generating doesn't take any lock. The results are then
+///	added to the graph in the order of the states with Graph_t::AddEdges(), which makes the
+///	graph the same for any number of threads. Call Graph_t::Freeze() afterwards to get a
+///	CsrGraph_t.
+///
+/// The number of edges added is returned. An exception thrown by the generator is rethrown
+///	after all threads have finished, the graph is not modified in this case. The same holds
+///	for the std::system_error thrown if a thread can't be started.
+template <typename StateType, typename TransitionType, typename IDIndexType, typename GetNeighbourFunc>
+std::size_t AddGeneratedEdges(Graph_t<StateType, TransitionType, IDIndexType> &graph, const std::vector<StateType> &states, GetNeighbourFunc &&get_neighbours, std::size_t thread_num = std::thread::hardware_concurrency());
+}
+
+#include "graph/details/graph_builder_impl.hpp"
+
+#endif /* GRAPH_BUILDER_HPP */
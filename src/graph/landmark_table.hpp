@@ -0,0 +1,109 @@
+/*
+ * landmark_table.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: landmark distance tables for the ALT (A*, landmarks, triangle inequality) heuristic
+ * Reference:
+ *  	1. A. V. Goldberg and C. Harrelson, Computing the shortest path: A* search meets graph theory, 2005
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef LANDMARK_TABLE_HPP
+#define LANDMARK_TABLE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+#include "graph/graph.hpp"
+
+namespace librav
+{
+
+/// Precomputed shortest distances between a set of landmarks and all vertices of a Graph_t,
+///	used to build a lower bound heuristic for AStar when the states have no geometric one.
+///
+/// For a landmark L the triangle inequality gives d(v, t) >= d(L, t) - d(L, v) and
+///	d(v, t) >= d(v, L) - d(t, L). The heuristic returns the largest of these bounds over the
+///	active landmarks, which is admissible and consistent. Landmarks are selected greedily,
+///	each new landmark is the vertex farthest from the ones selected so far.
+///
+/// Distances are stored as DistanceType in one array per direction, the distances of a vertex
+///	to all landmarks are contiguous. A float table halves the memory of the default double
+///	table. Each bound is then reduced by the largest possible rounding error of the stored
+///	distances, so it stays a lower bound and only gets slightly weaker. Use uint32_t only
+///	for integer costs.
+///
+/// The table refers to the graph to map states to vertex indices, so the graph must outlive
+///	the table and must not be modified after the table is built.
+template <typename StateType, typename TransitionType = double, typename DistanceType = double, typename IDIndexType = FlatIDIndex>
+class LandmarkTable_t
+{
+  public:
+	/// Distance stored for vertices that can't reach or can't be reached from a landmark
+	static constexpr DistanceType Unreachable = std::numeric_limits<DistanceType>::has_infinity ? std::numeric_limits<DistanceType>::infinity() : std::numeric_limits<DistanceType>::max();
+
+	/// The ALT heuristic, a callable that can be passed to AStar::Search() directly
+	class Heuristic
+	{
+	  public:
+		Heuristic(const LandmarkTable_t *table, std::vector<uint32_t> landmarks) : table_(table), landmarks_(std::move(landmarks)) {}
+
+		double operator()(const StateType &state, const StateType &goal_state) const;
+
+		/// Landmarks used by this heuristic
+		const std::vector<uint32_t> &GetLandmarks() const { return landmarks_; }
+
+	  private:
+		const LandmarkTable_t *table_;
+		std::vector<uint32_t> landmarks_;
+
+		// the goal is the same for all calls within a search, its index is looked up once
+		mutable uint64_t goal_id_ = 0;
+		mutable uint32_t goal_index_ = std::numeric_limits<uint32_t>::max();
+	};
+
+	/// Select landmark_num landmarks and compute the distance tables
+	LandmarkTable_t(const Graph_t<StateType, TransitionType, IDIndexType> &graph, std::size_t landmark_num);
+
+	/// Number of landmarks in the table
+	std::size_t GetLandmarkNumber() const { return landmark_ids_.size(); }
+
+	/// Get the vertex id of a landmark
+	uint64_t GetLandmarkID(uint32_t landmark) const { return landmark_ids_[landmark]; }
+
+	/// Lower bound of the distance between two vertices given by their vertex index
+	double GetLowerBound(uint32_t vertex_idx, uint32_t goal_idx, const std::vector<uint32_t> &landmarks) const;
+
+	/// Heuristic using all landmarks
+	Heuristic GetHeuristic() const;
+
+	/// Heuristic using the given subset of landmarks
+	Heuristic GetHeuristic(std::vector<uint32_t> landmarks) const;
+
+	/// Heuristic using the active_num landmarks that give the tightest bound between the
+	///	start and the goal, which is usually as good as using all of them at a lower cost
+	Heuristic GetHeuristic(uint64_t start_id, uint64_t goal_id, std::size_t active_num) const;
+
+  private:
+	const Graph_t<StateType, TransitionType, IDIndexType> *graph_;
+	std::vector<uint64_t> landmark_ids_;
+
+	// distance_from_[v * k + l] is d(L_l, v) and distance_to_[v * k + l] is d(v, L_l)
+	std::vector<DistanceType> distance_from_;
+	std::vector<DistanceType> distance_to_;
+
+	// relative error of a distance converted from double to DistanceType
+	static constexpr double RoundingError = std::is_same<DistanceType, float>::value ? std::numeric_limits<float>::epsilon() / 2 : 0.0;
+
+	void ComputeDistances(uint32_t source, bool forward, std::vector<double> &distances) const;
+	uint32_t GetVertexIndex(const StateType &state) const;
+};
+}
+
+#include "graph/details/landmark_table_impl.hpp"
+
+#endif /* LANDMARK_TABLE_HPP */
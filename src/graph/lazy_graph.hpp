@@ -0,0 +1,87 @@
+/*
+ * lazy_graph.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: graph that is expanded on demand by a neighbour generator
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef LAZY_GRAPH_HPP
+#define LAZY_GRAPH_HPP
+
+#include <vector>
+#include <tuple>
+#include <cstdint>
+#include <functional>
+
+#include "graph/graph.hpp"
+
+namespace librav
+{
+
+/// A function that generates the successors of a state together with the transition costs
+template <typename StateType, typename TransitionType = double>
+using GetNeighbourFunc_t = std::function<std::vector<std::tuple<StateType, TransitionType>>(StateType)>;
+
+/// A graph that is built while it's searched, for state spaces that are too large to be
+///	constructed with AddEdge() up front (lattices, configuration spaces, etc.).
+///
+/// Vertices are created when they are first generated and the successors of a vertex are
+///	only generated when the vertex is expanded by a search (see AStar::IncSearch()). The
+///	generated vertices and edges are cached across queries.
+///
+/// The cache can be capped with max_vertex_num (0 means unlimited). The cap is only checked
+///	in BeginQuery(), at the beginning of each query: if it's exceeded, the vertices that were
+///	least recently used by a query are evicted until half of the cap is used. Within a query
+///	the cache grows with every vertex the search generates, so a single query may take it
+///	beyond the cap. The predecessors of an evicted vertex are marked as unexpanded, so their
+///	successors are generated again when needed.
+template <typename StateType, typename TransitionType = double, typename IDIndexType = FlatIDIndex>
+class LazyGraph_t
+{
+  public:
+	typedef Vertex_t<StateType, TransitionType> VertexType;
+
+	explicit LazyGraph_t(GetNeighbourFunc_t<StateType, TransitionType> get_neighbours, std::size_t max_vertex_num = 0) : get_neighbours_(get_neighbours), max_vertex_num_(max_vertex_num) {}
+
+	/// The cached part of the graph
+	const Graph_t<StateType, TransitionType, IDIndexType> &GetGraph() const { return graph_; }
+
+	/// Number of vertices currently cached
+	std::size_t GetVertexNumber() const { return graph_.GetVertexNumber(); }
+
+	/// All vertex indices of the cached graph are smaller than the returned value
+	std::size_t GetVertexIndexBound() const { return graph_.GetVertexIndexBound(); }
+
+	/// Start a new query, vertices are evicted here if the cache exceeds the cap
+	void BeginQuery();
+
+	/// Get the vertex associated with the state, it's created if it's not in the cache yet
+	VertexType *GetVertex(StateType state);
+
+	/// Generate the successors of a vertex unless it's been expanded already
+	void ExpandVertex(VertexType *vertex);
+
+	/// Remove all cached vertices and edges
+	void Clear();
+
+  private:
+	Graph_t<StateType, TransitionType, IDIndexType> graph_;
+	GetNeighbourFunc_t<StateType, TransitionType> get_neighbours_;
+	std::size_t max_vertex_num_;
+
+	// per vertex index: whether the successors have been generated and the last query
+	//	that used the vertex
+	std::vector<bool> expanded_;
+	std::vector<uint32_t> last_used_;
+	uint32_t query_count_ = 0;
+
+	void Touch(VertexType *vertex);
+	void Evict(std::size_t vertex_num);
+};
+}
+
+#include "graph/details/lazy_graph_impl.hpp"
+
+#endif /* LAZY_GRAPH_HPP */
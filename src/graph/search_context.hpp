@@ -0,0 +1,242 @@
+/*
+ * search_context.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: per-query search information kept outside of the graph
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef SEARCH_CONTEXT_HPP
+#define SEARCH_CONTEXT_HPP
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+#include "graph/details/priority_queue.hpp"
+
+namespace librav
+{
+
+/// Search information of a vertex for one query.
+struct SearchInfo
+{
+	// the query this information belongs to, see SearchContext
+	uint32_t epoch_ = 0;
+
+	bool is_checked_ = false;
+	bool is_in_openlist_ = false;
+	double f_astar_ = 0;
+	double g_astar_ = 0;
+	double h_astar_ = 0;
+	uint32_t search_parent_ = 0;
+};
+
+/// Counters of one query, recorded in the SearchContext used by the query
+struct SearchStatistics
+{
+	// vertices taken from the open list and expanded
+	std::size_t expanded_num_ = 0;
+	// entries put into the open list
+	std::size_t pushed_num_ = 0;
+	// entries taken from the open list for vertices that were expanded already
+	std::size_t stale_pop_num_ = 0;
+	std::size_t max_openlist_size_ = 0;
+	// wall time of the query in seconds
+	double search_time_ = 0;
+};
+
+/// Outcome of a query: the path from start to goal, its cost and the statistics of the query.
+///	The path is empty and the cost is 0 if no path is found.
+template <typename PathType>
+struct SearchResult
+{
+	bool found_ = false;
+	PathType path_;
+	double cost_ = 0;
+	SearchStatistics statistics_;
+};
+
+/// Summary of a query that is passed to the search log hook
+struct SearchLogRecord
+{
+	const char *algorithm_;
+	uint64_t start_id_;
+	uint64_t goal_id_;
+	bool found_;
+	std::size_t path_length_;
+	double cost_;
+	SearchStatistics statistics_;
+};
+
+typedef std::function<void(const SearchLogRecord &)> SearchLogFunc;
+
+/// The hook called after each query of AStar and Dijkstra. No hook is set by default, so the
+///	searches don't do any I/O. Set it before searches start, it's called from the thread that
+///	runs the query.
+inline SearchLogFunc &GetSearchLogHook()
+{
+	static SearchLogFunc hook;
+	return hook;
+}
+
+inline void SetSearchLogHook(SearchLogFunc hook) { GetSearchLogHook() = std::move(hook); }
+
+/// A log hook that prints the summary of each query to std::cout
+inline void PrintSearchLog(const SearchLogRecord &record)
+{
+	if (record.found_)
+		std::cout << record.algorithm_ << ": path found from " << record.start_id_ << " to " << record.goal_id_
+				  << ", path length: " << record.path_length_ << ", total cost: " << record.cost_
+				  << ", expanded vertices: " << record.statistics_.expanded_num_ << "\n";
+	else
+		std::cout << record.algorithm_ << ": failed to find a path from " << record.start_id_ << " to " << record.goal_id_ << "\n";
+}
+
+/// A caller-owned table of per-query search information, indexed by the dense vertex
+///	index of a graph (Vertex_t::vertex_index_ or the index of a CsrGraph_t vertex).
+///
+/// The graph itself is not modified by a search that uses a SearchContext, so a single
+///	const graph can be searched from several threads at the same time as long as each
+///	thread uses its own context.
+///
+/// Resetting a context is O(1): every record is stamped with the epoch of the query that
+///	wrote it and a record with a stale epoch is treated as fresh the first time it's
+///	accessed. The cost of a query is therefore proportional to the explored region only,
+///	provided the same context is reused across queries.
+class SearchContext
+{
+  public:
+	/// Prepare the context for a new search on a graph whose vertex indices are
+	///	all smaller than vertex_index_bound
+	void Reset(std::size_t vertex_index_bound)
+	{
+		if (search_info_.size() < vertex_index_bound)
+			search_info_.resize(vertex_index_bound);
+
+		// start a new epoch, records are only cleared when the counter wraps around
+		if (++epoch_ == 0)
+		{
+			search_info_.assign(search_info_.size(), SearchInfo());
+			epoch_ = 1;
+		}
+
+		statistics_ = SearchStatistics();
+	}
+
+	/// Statistics of the current or last query
+	SearchStatistics &GetStatistics() { return statistics_; }
+	const SearchStatistics &GetStatistics() const { return statistics_; }
+
+	/// Make room for vertices added to the graph during the current search, the information
+	///	already recorded by the search is kept
+	void Extend(std::size_t vertex_index_bound)
+	{
+		if (search_info_.size() < vertex_index_bound)
+			search_info_.resize(vertex_index_bound);
+	}
+
+	/// Number of vertices the context currently holds information for
+	std::size_t GetSize() const { return search_info_.size(); }
+
+	/// Access the search information of the vertex with given index, the record is
+	///	cleared if it was written by a previous query
+	SearchInfo &GetSearchInfo(uint32_t vertex_index)
+	{
+		SearchInfo &info = search_info_[vertex_index];
+		if (info.epoch_ != epoch_)
+		{
+			info = SearchInfo();
+			info.epoch_ = epoch_;
+		}
+		return info;
+	}
+
+	/// Read-only access, a record that is not touched by the current query reads as fresh
+	const SearchInfo &GetSearchInfo(uint32_t vertex_index) const
+	{
+		static const SearchInfo fresh_info;
+		const SearchInfo &info = search_info_[vertex_index];
+		return (info.epoch_ == epoch_) ? info : fresh_info;
+	}
+
+	/// Check if the vertex with given index has been reached by the current query
+	bool IsVisited(uint32_t vertex_index) const { return search_info_[vertex_index].epoch_ == epoch_; }
+
+	/// Get the list of vertex indices from start to goal by following the search parents.
+	///	It's only valid after a search that has reached the goal.
+	std::vector<uint32_t> ReconstructPath(uint32_t start_index, uint32_t goal_index) const
+	{
+		std::vector<uint32_t> path;
+		ReconstructPath(start_index, goal_index, path);
+
+		return path;
+	}
+
+	/// Write the path from start to goal into the given buffer, which is resized to the length
+	///	of the path. The memory of the buffer is reused if it's large enough.
+	void ReconstructPath(uint32_t start_index, uint32_t goal_index, std::vector<uint32_t> &path) const
+	{
+		// count the waypoints first, so that the path is filled from the back without reversing
+		std::size_t waypoint_num = 1;
+		for (uint32_t waypoint = goal_index; waypoint != start_index; waypoint = search_info_[waypoint].search_parent_)
+			++waypoint_num;
+
+		path.resize(waypoint_num);
+		for (uint32_t waypoint = goal_index; waypoint != start_index; waypoint = search_info_[waypoint].search_parent_)
+			path[--waypoint_num] = waypoint;
+		// add the start node
+		path[0] = start_index;
+	}
+
+  private:
+	std::vector<SearchInfo> search_info_;
+	uint32_t epoch_ = 0;
+	SearchStatistics statistics_;
+};
+
+/// Caller-owned buffers of repeated searches: the search context, the open list and the path.
+///	Keep one workspace per thread and pass it to AStar::Search() or Dijkstra::Search(). Once
+///	the buffers have grown to the size the queries need, a search doesn't allocate memory.
+template <typename OpenListType = PriorityQueue<uint32_t>>
+struct SearchWorkspace
+{
+	SearchContext context_;
+	OpenListType openlist_;
+
+	// dense vertex indices of the path found by the last search, from start to goal. It's
+	//	empty if no path was found.
+	std::vector<uint32_t> path_;
+};
+
+/// Caller-owned state of a bidirectional search: one context for the forward search from
+///	the start and one for the backward search from the goal.
+struct BidirectionalSearchContext
+{
+	SearchContext forward_;
+	SearchContext backward_;
+
+	// where the two searches meet on the shortest path and the length of the path
+	uint32_t meeting_vertex_ = 0;
+	double path_cost_ = 0;
+
+	/// Get the list of vertex indices from start to goal through the meeting vertex.
+	///	It's only valid after a search that has found a path.
+	std::vector<uint32_t> ReconstructPath(uint32_t start_index, uint32_t goal_index) const
+	{
+		std::vector<uint32_t> path = forward_.ReconstructPath(start_index, meeting_vertex_);
+		for (uint32_t waypoint = meeting_vertex_; waypoint != goal_index;)
+		{
+			waypoint = backward_.GetSearchInfo(waypoint).search_parent_;
+			path.push_back(waypoint);
+		}
+
+		return path;
+	}
+};
+}
+
+#endif /* SEARCH_CONTEXT_HPP */
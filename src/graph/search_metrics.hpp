@@ -0,0 +1,189 @@
+/*
+ * search_metrics.hpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: process-wide latency and work histograms of searches
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#ifndef SEARCH_METRICS_HPP
+#define SEARCH_METRICS_HPP
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <ostream>
+#include <functional>
+
+#include "graph/search_context.hpp"
+
+namespace librav
+{
+
+/// A histogram with log-linear buckets in the style of HdrHistogram. Values below 32 are
+///	counted exactly, larger values fall into one of 32 buckets per power of two, so any
+///	value read back is at most about 3% above the recorded one. Values are clamped to
+///	MaxValue.
+class MetricHistogram
+{
+  public:
+	static constexpr uint32_t SubBucketBits = 5;
+	static constexpr uint32_t SubBucketNum = 1 << SubBucketBits;
+	static constexpr uint32_t MaxValueBits = 40;
+	static constexpr uint64_t MaxValue = (uint64_t(1) << MaxValueBits) - 1;
+	static constexpr uint32_t BucketNum = (MaxValueBits - SubBucketBits + 1) * SubBucketNum;
+
+	/// Bucket of a value and the largest value counted in a bucket
+	static uint32_t GetBucketIndex(uint64_t value);
+	static uint64_t GetBucketUpperBound(uint32_t index);
+
+	void Record(uint64_t value, uint64_t count = 1);
+	void Merge(const MetricHistogram &other);
+	void Clear();
+
+	uint64_t GetCount() const { return count_; }
+	uint64_t GetMax() const { return max_; }
+	double GetMean() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_) / count_; }
+
+	/// The smallest value that at least the given percent of the recorded values are not
+	///	larger than, e.g. GetValueAtPercentile(99.9) for p999. It's 0 if nothing is recorded.
+	uint64_t GetValueAtPercentile(double percentile) const;
+
+  private:
+	friend class SearchMetrics;
+
+	std::vector<uint64_t> buckets_ = std::vector<uint64_t>(BucketNum, 0);
+	uint64_t count_ = 0;
+	uint64_t sum_ = 0;
+	uint64_t max_ = 0;
+};
+
+/// Merged metrics of the queries of one search algorithm
+struct SearchEngineMetrics
+{
+	std::string algorithm_;
+	uint64_t query_num_ = 0;
+	uint64_t found_num_ = 0;
+
+	// wall time of the queries in nanoseconds
+	MetricHistogram latency_;
+	// vertices expanded per query
+	MetricHistogram expanded_num_;
+	// peak open list size per query
+	MetricHistogram max_openlist_size_;
+};
+
+/// Process-wide registry of search metrics, broken down by algorithm. AStar and Dijkstra
+///	record every query here while the registry is enabled, it's disabled by default.
+///
+/// Each thread records into histograms of its own with plain atomic loads and stores, so
+///	recording doesn't take a lock and threads don't share cache lines. The histograms of
+///	all threads are merged when the metrics are read, which may run concurrently with
+///	searches. Up to MaxEngineNum algorithms are tracked, queries of further algorithms
+///	are not recorded.
+class SearchMetrics
+{
+  public:
+	static constexpr std::size_t MaxEngineNum = 8;
+
+	SearchMetrics(const SearchMetrics &) = delete;
+	SearchMetrics &operator=(const SearchMetrics &) = delete;
+
+	void Enable(bool enabled = true) { enabled_.store(enabled, std::memory_order_relaxed); }
+	bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+	/// Record a query, the name of the algorithm must be a string literal
+	void Record(const char *algorithm, bool found, const SearchStatistics &statistics);
+
+	/// Metrics of all queries recorded so far, sorted by algorithm
+	std::vector<SearchEngineMetrics> GetSnapshot() const;
+
+	/// Pass the current metrics of each algorithm to a callback
+	void Export(const std::function<void(const SearchEngineMetrics &)> &callback) const;
+
+	/// Write the current metrics as text, latencies are given in microseconds
+	void WriteSnapshot(std::ostream &os) const;
+	bool WriteSnapshot(const std::string &filename) const;
+
+	/// Drop all recorded metrics. Queries recorded while clearing may be partly kept.
+	void Clear();
+
+	/// Number of per-thread histogram sets, at most the number of threads that recorded
+	///	queries at the same time
+	std::size_t GetShardNumber() const;
+
+  private:
+	friend SearchMetrics &GetSearchMetrics();
+
+	// histogram written by one thread and read by any
+	struct AtomicHistogram
+	{
+		std::array<std::atomic<uint64_t>, MetricHistogram::BucketNum> buckets_;
+		std::atomic<uint64_t> count_;
+		std::atomic<uint64_t> sum_;
+		std::atomic<uint64_t> max_;
+
+		AtomicHistogram();
+		void Record(uint64_t value);
+		void MergeInto(MetricHistogram &histogram) const;
+		void Clear();
+	};
+
+	struct EngineSlot
+	{
+		const char *algorithm_;
+		std::atomic<uint64_t> query_num_;
+		std::atomic<uint64_t> found_num_;
+		AtomicHistogram latency_;
+		AtomicHistogram expanded_num_;
+		AtomicHistogram max_openlist_size_;
+
+		explicit EngineSlot(const char *algorithm) : algorithm_(algorithm), query_num_(0), found_num_(0) {}
+	};
+
+	// the metrics recorded by one thread at a time. When the thread exits, its shard is
+	//	handed to the next thread that records, the counts are kept.
+	struct Shard
+	{
+		std::array<std::atomic<EngineSlot *>, MaxEngineNum> engines_;
+
+		Shard();
+		~Shard();
+		EngineSlot *GetEngine(const char *algorithm);
+	};
+
+	// returns the shard of a thread to the registry when the thread exits
+	struct ShardOwner
+	{
+		SearchMetrics *metrics_ = nullptr;
+		Shard *shard_ = nullptr;
+
+		~ShardOwner();
+	};
+
+	SearchMetrics() = default;
+
+	// counters of a shard are only written by the thread that owns the shard, so a relaxed
+	//	load and store is enough to update them and is cheaper than a read-modify-write
+	static void AddRelaxed(std::atomic<uint64_t> &counter, uint64_t value);
+
+	Shard *GetThreadShard();
+
+	std::atomic<bool> enabled_{false};
+	mutable std::mutex shards_mutex_;
+	std::vector<std::unique_ptr<Shard>> shards_;
+	std::vector<Shard *> free_shards_;
+};
+
+/// The registry fed by the searches of this process, it lives until the process exits
+SearchMetrics &GetSearchMetrics();
+}
+
+#include "graph/details/search_metrics_impl.hpp"
+
+#endif /* SEARCH_METRICS_HPP */
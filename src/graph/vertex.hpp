@@ -11,13 +11,29 @@
 #define VERTEX_HPP
 
 #include <cstdint>
+#include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #include "graph/edge.hpp"
+#include "graph/details/graph_arena.hpp"
+#include "graph/details/small_vector.hpp"
 
 namespace librav
 {
 
+/// Policy that sets how many edges the edge lists of a vertex store inline, without allocating.
+///	StateType is the state type without pointer, reference and const qualifiers. Specialize it
+///	for a state type whose vertices usually have more neighbours, e.g. 8-connected grid cells:
+///
+///		template <>
+///		struct EdgeListPolicy<MyCell> { static constexpr std::size_t InlineEdgeNum = 8; };
+template <typename StateType>
+struct EdgeListPolicy
+{
+	static constexpr std::size_t InlineEdgeNum = 4;
+};
+
 /****************************************************************************/
 /*								 Vertex_t										*/
 /****************************************************************************/
@@ -26,36 +42,55 @@ template <typename StateType, typename TransitionType>
 class Vertex_t
 {
   public:
+	/// The edge lists take their memory from arena if it's given, otherwise from the heap. The
+	///	state is taken as StateType so that a reference type binds to the caller's object.
 	template <class T = StateType, typename std::enable_if<std::is_pointer<T>::value>::type * = nullptr>
-	Vertex_t(T state_node);
+	Vertex_t(StateType state_node, GraphArena *arena = nullptr);
 
 	template <class T = StateType, typename std::enable_if<!std::is_pointer<T>::value>::type * = nullptr>
-	Vertex_t(T state_node);
+	Vertex_t(StateType state_node, GraphArena *arena = nullptr);
 
 	~Vertex_t() = default;
 
 	// friends
-	template <typename T1, typename T2>
+	template <typename T1, typename T2, typename T3>
 	friend class Graph_t;
-	friend class AStar;
+
+	typedef typename std::remove_const<typename std::remove_reference<typename std::remove_pointer<StateType>::type>::type>::type BaseStateType;
+	static constexpr std::size_t InlineEdgeNum = EdgeListPolicy<BaseStateType>::InlineEdgeNum;
+
+	typedef OutEdge<Vertex_t<StateType,TransitionType>*, TransitionType> OutEdgeType;
+	typedef InEdge<Vertex_t<StateType,TransitionType>*, TransitionType> InEdgeType;
+	typedef SmallVector<OutEdgeType, InlineEdgeNum, ArenaAllocator<OutEdgeType>> OutEdgeListType;
+	typedef SmallVector<InEdgeType, InlineEdgeNum, ArenaAllocator<InEdgeType>> InEdgeListType;
+
+	// The members are ordered by how often a forward search touches them. The index and the
+	//	first outgoing edges share the first cache line and the id follows them. The incoming
+	//	edges are only read by backward searches and when edges are removed, the state is only
+	//	read by heuristics. Both are kept at the end so that they don't separate the others.
+
+	// dense index assigned by the graph, used to address per-query search information
+	uint32_t vertex_index_;
+
+	// edges connecting to other vertices (dst_ is the other vertex)
+	OutEdgeListType edges_to_;
 
 	// generic attributes
-	StateType state_;
 	uint64_t vertex_id_;
 
-	// edges connecting to other vertices
-	std::vector<Edge<Vertex_t<StateType,TransitionType>*, TransitionType>> edges_to_;
+	// edges from other vertices connecting to current vertex (src_ is the other vertex),
+	//	used by backward searches and to cleanup edges in other vertices if current vertex is deleted
+	InEdgeListType edges_from_;
 
-	// vertices that contain edges connecting to current vertex, 
-	//	used to cleanup edges in other vertices if current vertex is deleted 
-	std::vector<Vertex_t<StateType,TransitionType> *> vertices_from_;
+	StateType state_;
 
   public:
 	/// == operator overloading. If two vertices have the same id, they're regarded as equal.
 	bool operator==(const Vertex_t<StateType,TransitionType> &other) const;
 
-	/// Get edge cost from current vertex to given vertex. -1 is returned if no edge between
-	///		the two vertices exists.
+	/// Get edge cost from current vertex to given vertex. Infinity (or the largest value of
+	///		TransitionType if it has no infinity) is returned if no edge between the two
+	///		vertices exists.
 	TransitionType GetEdgeCost(const Vertex_t<StateType,TransitionType> &dst_node) const;
 
 	/// Get all neighbor vertices of this vertex.
@@ -63,19 +98,6 @@ class Vertex_t
 
 	/// Check if a given vertex is the neighbor of current vertex.
 	bool CheckNeighbour(Vertex_t<StateType,TransitionType> *dst_node);
-
-  private:
-	// attributes for A* search
-	bool is_checked_;
-	bool is_in_openlist_;
-	double f_astar_;
-	double g_astar_;
-	double h_astar_;
-	Vertex_t<StateType,TransitionType> *search_parent_;
-
-  private:
-	/// Clear exiting search info before a new search
-	void ClearVertexSearchInfo();
 };
 }
 
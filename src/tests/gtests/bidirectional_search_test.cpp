@@ -0,0 +1,149 @@
+/* 
+ * bidirectional_search_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+#include "graph/algorithms/bidirectional_astar.hpp"
+#include "graph/algorithms/bidirectional_dijkstra.hpp"
+
+using namespace librav;
+
+struct BidirTestState
+{
+	BidirTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+struct BidirGridState
+{
+	BidirGridState(int32_t x, int32_t y):x_(x), y_(y){};
+
+	int32_t x_;
+	int32_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 32 + x_;
+	}
+};
+
+template <typename PathType>
+double GetPathCost(const PathType& path)
+{
+	double cost = 0;
+	for(std::size_t i = 0; i + 1 < path.size(); ++i)
+		cost += path[i]->GetEdgeCost(*path[i + 1]);
+	return cost;
+}
+
+TEST(BidirectionalSearchTest, RandomGraph)
+{
+	Graph_t<BidirTestState> graph;
+
+	std::mt19937 gen(7);
+	std::uniform_int_distribution<uint64_t> vertex_dist(0, 199);
+	std::uniform_int_distribution<int> cost_dist(1, 20);
+	for(int i = 0; i < 800; i++)
+		graph.AddEdge(BidirTestState(vertex_dist(gen)), BidirTestState(vertex_dist(gen)), cost_dist(gen));
+	auto csr = graph.Freeze();
+
+	SearchContext context;
+	BidirectionalSearchContext bidir_context;
+	for(int k = 0; k < 100; k++)
+	{
+		uint64_t start = vertex_dist(gen);
+		uint64_t goal = vertex_dist(gen);
+		if(graph.GetVertexFromID(start) == nullptr || graph.GetVertexFromID(goal) == nullptr)
+			continue;
+
+		auto path = Dijkstra::Search(graph, context, start, goal);
+		auto bidir_path = BidirectionalDijkstra::Search(graph, bidir_context, start, goal);
+		ASSERT_EQ(bidir_path.empty(), path.empty());
+		if(path.empty())
+			continue;
+
+		double cost = context.GetSearchInfo(graph.GetVertexFromID(goal)->vertex_index_).g_astar_;
+		ASSERT_DOUBLE_EQ(bidir_context.path_cost_, cost);
+		ASSERT_DOUBLE_EQ(GetPathCost(bidir_path), cost);
+		ASSERT_EQ(bidir_path.front()->vertex_id_, start);
+		ASSERT_EQ(bidir_path.back()->vertex_id_, goal);
+
+		auto csr_path = BidirectionalDijkstra::Search<IndexedDaryHeap<4>>(csr, bidir_context, start, goal);
+		ASSERT_DOUBLE_EQ(bidir_context.path_cost_, cost);
+		ASSERT_EQ(csr.GetVertexID(csr_path.front()), start);
+		ASSERT_EQ(csr.GetVertexID(csr_path.back()), goal);
+	}
+}
+
+TEST(BidirectionalSearchTest, GridWithHeuristic)
+{
+	Graph_t<BidirGridState> graph;
+
+	// 32x32 4-connected grid with a wall at x = 16 except at y = 31
+	for(int32_t y = 0; y < 32; y++)
+		for(int32_t x = 0; x < 32; x++)
+		{
+			if(x == 16 && y != 31)
+				continue;
+			if(x + 1 < 32 && !(x + 1 == 16 && y != 31))
+			{
+				graph.AddEdge(BidirGridState(x, y), BidirGridState(x + 1, y), 1.0);
+				graph.AddEdge(BidirGridState(x + 1, y), BidirGridState(x, y), 1.0);
+			}
+			if(y + 1 < 32 && !(x == 16 && y + 1 != 31))
+			{
+				graph.AddEdge(BidirGridState(x, y), BidirGridState(x, y + 1), 1.0);
+				graph.AddEdge(BidirGridState(x, y + 1), BidirGridState(x, y), 1.0);
+			}
+		}
+
+	auto manhattan = [](const BidirGridState& a, const BidirGridState& b) {
+		return static_cast<double>(std::abs(a.x_ - b.x_) + std::abs(a.y_ - b.y_));
+	};
+
+	auto path = BidirectionalAStar::Search(graph, 0, 31, manhattan);
+	ASSERT_EQ(path.size(), 94);
+	ASSERT_DOUBLE_EQ(GetPathCost(path), 93);
+
+	auto dpath = BidirectionalDijkstra::Search(graph, 0, 31);
+	ASSERT_EQ(dpath.size(), 94);
+
+	SearchContext context;
+	BidirectionalSearchContext bidir_context;
+	for(uint64_t start = 0; start < 1024; start += 37)
+		for(uint64_t goal = 1; goal < 1024; goal += 101)
+		{
+			auto ref = AStar::Search(graph, context, start, goal, manhattan);
+			auto bidir_path = BidirectionalAStar::Search<BucketQueue<>>(graph, bidir_context, start, goal, manhattan);
+			ASSERT_EQ(bidir_path.size(), ref.size());
+		}
+
+	// same start and goal
+	ASSERT_EQ(BidirectionalAStar::Search(graph, 5, 5, manhattan).size(), 1);
+
+	// the backward search follows the incoming edges, which are updated when edges are removed
+	graph.RemoveEdge(BidirGridState(16, 30), BidirGridState(16, 31));
+	graph.RemoveEdge(BidirGridState(16, 31), BidirGridState(16, 30));
+	graph.RemoveVertex(BidirGridState(16, 31));
+	ASSERT_TRUE(BidirectionalAStar::Search(graph, 0, 31, manhattan).empty());
+	ASSERT_TRUE(BidirectionalDijkstra::Search(graph.Freeze(), 0, 31).empty());
+}
@@ -0,0 +1,106 @@
+/* 
+ * contraction_hierarchy_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/contraction_hierarchy.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct ChTestState
+{
+	ChTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+TEST(ContractionHierarchyTest, RandomGraph)
+{
+	Graph_t<ChTestState> graph;
+
+	// a sparse random directed graph with a removed vertex to leave a hole in the indices
+	std::mt19937 gen(11);
+	std::uniform_int_distribution<uint64_t> vertex_dist(0, 299);
+	std::uniform_int_distribution<int> cost_dist(1, 20);
+	for(int i = 0; i < 1000; i++)
+		graph.AddEdge(ChTestState(vertex_dist(gen)), ChTestState(vertex_dist(gen)), cost_dist(gen));
+	graph.RemoveVertex(ChTestState(0));
+
+	ContractionHierarchy_t<ChTestState> ch(graph, 4);
+
+	SearchContext context;
+	BidirectionalSearchContext ch_context;
+	std::size_t found_num = 0;
+	for(int k = 0; k < 300; k++)
+	{
+		uint64_t start = vertex_dist(gen);
+		uint64_t goal = vertex_dist(gen);
+		if(graph.GetVertexFromID(start) == nullptr || graph.GetVertexFromID(goal) == nullptr)
+			continue;
+
+		auto path = Dijkstra::Search(graph, context, start, goal);
+		auto ch_path = ch.Search(ch_context, start, goal);
+		ASSERT_EQ(ch_path.empty(), path.empty());
+		if(path.empty())
+			continue;
+		++found_num;
+
+		// the unpacked path consists of original edges and has the shortest cost
+		double cost = 0;
+		for(std::size_t i = 0; i + 1 < ch_path.size(); ++i)
+		{
+			ASSERT_TRUE(ch_path[i]->CheckNeighbour(ch_path[i + 1]));
+			cost += ch_path[i]->GetEdgeCost(*ch_path[i + 1]);
+		}
+		ASSERT_EQ(ch_path.front()->vertex_id_, start);
+		ASSERT_EQ(ch_path.back()->vertex_id_, goal);
+		ASSERT_DOUBLE_EQ(cost, context.GetSearchInfo(graph.GetVertexFromID(goal)->vertex_index_).g_astar_);
+		ASSERT_DOUBLE_EQ(ch_context.path_cost_, cost);
+	}
+	ASSERT_GT(found_num, 0);
+}
+
+TEST(ContractionHierarchyTest, Grid)
+{
+	Graph_t<ChTestState> graph;
+
+	// 20x20 4-connected grid
+	for(int64_t y = 0; y < 20; y++)
+		for(int64_t x = 0; x < 20; x++)
+		{
+			if(x + 1 < 20)
+			{
+				graph.AddEdge(ChTestState(y * 20 + x), ChTestState(y * 20 + x + 1), 1.0);
+				graph.AddEdge(ChTestState(y * 20 + x + 1), ChTestState(y * 20 + x), 1.0);
+			}
+			if(y + 1 < 20)
+			{
+				graph.AddEdge(ChTestState(y * 20 + x), ChTestState((y + 1) * 20 + x), 1.0);
+				graph.AddEdge(ChTestState((y + 1) * 20 + x), ChTestState(y * 20 + x), 1.0);
+			}
+		}
+
+	ContractionHierarchy_t<ChTestState> ch(graph);
+
+	ASSERT_EQ(ch.Search(0, 399).size(), 39);
+	ASSERT_EQ(ch.Search(399, 0).size(), 39);
+	ASSERT_EQ(ch.Search(19, 380).size(), 39);
+	ASSERT_EQ(ch.Search(5, 5).size(), 1);
+	ASSERT_TRUE(ch.Search(0, 400).empty());
+}
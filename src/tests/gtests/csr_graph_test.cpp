@@ -0,0 +1,111 @@
+/* 
+ * csr_graph_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/csr_graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct CsrTestState
+{
+	CsrTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+double CsrTestHeuristic(CsrTestState, CsrTestState)
+{
+	return 0.0;
+}
+
+struct CsrGraphTest: testing::Test
+{
+	std::vector<CsrTestState> nodes;
+	Graph_t<CsrTestState> graph;
+
+	CsrGraphTest()
+	{
+		for(int i = 0; i < 9; i++)
+			nodes.push_back(CsrTestState(i));
+
+		graph.AddEdge(nodes[0], nodes[1], 1.0);
+		graph.AddEdge(nodes[0], nodes[3], 1.5);
+		graph.AddEdge(nodes[1], nodes[0], 2.0);
+		graph.AddEdge(nodes[1], nodes[4], 2.5);
+		graph.AddEdge(nodes[1], nodes[2], 1.0);
+		graph.AddEdge(nodes[2], nodes[1], 1.5);
+		graph.AddEdge(nodes[2], nodes[5], 2.0);
+		graph.AddEdge(nodes[3], nodes[0], 2.5);
+		graph.AddEdge(nodes[3], nodes[4], 2.5);
+		graph.AddEdge(nodes[4], nodes[1], 2.5);
+		graph.AddEdge(nodes[4], nodes[3], 2.5);
+		graph.AddEdge(nodes[4], nodes[5], 2.5);
+		graph.AddEdge(nodes[5], nodes[2], 2.5);
+		graph.AddEdge(nodes[5], nodes[4], 2.5);
+		graph.AddEdge(nodes[5], nodes[8], 2.5);
+		graph.AddEdge(nodes[7], nodes[4], 2.5);
+		graph.AddEdge(nodes[7], nodes[8], 2.5);
+		graph.AddEdge(nodes[8], nodes[5], 2.5);
+		graph.AddEdge(nodes[8], nodes[7], 2.5);
+	}
+};
+
+TEST_F(CsrGraphTest, Layout)
+{
+	auto csr = graph.Freeze();
+
+	ASSERT_EQ(csr.GetVertexNumber(), graph.GetGraphVertices().size());
+	ASSERT_EQ(csr.GetEdgeNumber(), graph.GetGraphEdges().size());
+	ASSERT_EQ(csr.GetVertexIndex(6), CsrGraph_t<CsrTestState>::InvalidIndex);
+
+	for(auto vtx : graph.GetGraphVertices())
+	{
+		uint32_t idx = csr.GetVertexIndex(vtx->vertex_id_);
+		ASSERT_EQ(csr.GetVertexID(idx), vtx->vertex_id_);
+		ASSERT_EQ(csr.GetVertexState(idx).GetUniqueID(), vtx->vertex_id_);
+		ASSERT_EQ(csr.EdgeEnd(idx) - csr.EdgeBegin(idx), vtx->edges_to_.size());
+
+		for(uint32_t e = csr.EdgeBegin(idx); e < csr.EdgeEnd(idx); ++e)
+		{
+			auto dst = graph.GetVertexFromID(csr.GetVertexID(csr.EdgeDestination(e)));
+			ASSERT_EQ(vtx->GetEdgeCost(*dst), csr.EdgeCost(e));
+		}
+	}
+}
+
+TEST_F(CsrGraphTest, Search)
+{
+	auto csr = graph.Freeze();
+
+	auto path = AStar::Search(graph, 0, 8, CalcHeuristicFunc_t<CsrTestState>(CsrTestHeuristic));
+	auto csr_path = AStar::Search(csr, 0, 8, CalcHeuristicFunc_t<CsrTestState>(CsrTestHeuristic));
+	auto csr_dpath = Dijkstra::Search(csr, 0, 8);
+
+	ASSERT_EQ(csr_path.size(), path.size());
+	ASSERT_EQ(csr_dpath.size(), path.size());
+	for(std::size_t i = 0; i < path.size(); ++i)
+	{
+		ASSERT_EQ(csr.GetVertexID(csr_path[i]), path[i]->vertex_id_);
+		ASSERT_EQ(csr.GetVertexID(csr_dpath[i]), path[i]->vertex_id_);
+	}
+
+	ASSERT_TRUE(AStar::Search(csr, 0, 6, CalcHeuristicFunc_t<CsrTestState>(CsrTestHeuristic)).empty());
+	ASSERT_TRUE(Dijkstra::Search(csr, 8, 6).empty());
+}
@@ -0,0 +1,103 @@
+/* 
+ * dstarlite_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+#include "graph/algorithms/dstarlite.hpp"
+
+using namespace librav;
+
+struct DStarCell
+{
+	DStarCell(int64_t x, int64_t y):x_(x), y_(y){};
+
+	int64_t x_;
+	int64_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 20 + x_;
+	}
+};
+
+struct DStarManhattan
+{
+	double operator()(const DStarCell &a, const DStarCell &b) const
+	{
+		return std::abs(a.x_ - b.x_) + std::abs(a.y_ - b.y_);
+	}
+};
+
+TEST(DStarLiteTest, MovingStart)
+{
+	// 20x20 4-connected grid with random costs of at least 1
+	Graph_t<DStarCell> graph;
+	std::vector<std::pair<DStarCell, DStarCell>> edges;
+	std::mt19937 gen(9);
+	std::uniform_int_distribution<int> cost_dist(1, 10);
+	for(int64_t y = 0; y < 20; y++)
+		for(int64_t x = 0; x < 20; x++)
+		{
+			if(x + 1 < 20)
+			{
+				edges.emplace_back(DStarCell(x, y), DStarCell(x + 1, y));
+				edges.emplace_back(DStarCell(x + 1, y), DStarCell(x, y));
+			}
+			if(y + 1 < 20)
+			{
+				edges.emplace_back(DStarCell(x, y), DStarCell(x, y + 1));
+				edges.emplace_back(DStarCell(x, y + 1), DStarCell(x, y));
+			}
+		}
+	for(auto& edge : edges)
+		graph.AddEdge(edge.first, edge.second, cost_dist(gen));
+
+	const uint64_t goal = DStarCell(19, 19).GetUniqueID();
+	uint64_t start = DStarCell(0, 0).GetUniqueID();
+
+	DStarLite<DStarCell, double, DStarManhattan> dstar(graph, DStarManhattan());
+	ASSERT_TRUE(dstar.SetStartGoal(start, goal));
+
+	SearchContext context;
+	std::uniform_int_distribution<std::size_t> edge_dist(0, edges.size() - 1);
+	std::size_t steps = 0;
+	while(start != goal)
+	{
+		auto path = dstar.ComputeShortestPath();
+		auto reference = Dijkstra::Search(graph, context, start, goal);
+		ASSERT_EQ(path.empty(), reference.empty());
+		if(path.empty())
+			break;
+
+		ASSERT_EQ(path.front()->vertex_id_, start);
+		ASSERT_EQ(path.back()->vertex_id_, goal);
+		ASSERT_DOUBLE_EQ(dstar.GetPathCost(), context.GetSearchInfo(graph.GetVertexFromID(goal)->vertex_index_).g_astar_);
+
+		// take one step and change the map
+		start = path[1]->vertex_id_;
+		ASSERT_TRUE(dstar.MoveStart(start));
+		for(int i = 0; i < 10; i++)
+		{
+			auto& edge = edges[edge_dist(gen)];
+			dstar.UpdateEdgeCost(edge.first, edge.second, cost_dist(gen));
+		}
+		auto& removed = edges[edge_dist(gen)];
+		if(graph.RemoveEdge(removed.first, removed.second))
+			dstar.NotifyEdgeChange(removed.first);
+
+		ASSERT_LT(++steps, 400);
+	}
+	ASSERT_EQ(start, goal);
+}
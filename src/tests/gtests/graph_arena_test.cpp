@@ -0,0 +1,82 @@
+/* 
+ * graph_arena_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+
+using namespace librav;
+
+struct ArenaTestState
+{
+	ArenaTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+TEST(GraphArenaTest, BlocksAreReused)
+{
+	GraphArena arena;
+
+	void *small = arena.Allocate(24);
+	void *large = arena.Allocate(5000);
+	ASSERT_EQ(reinterpret_cast<uintptr_t>(small) % GraphArena::Alignment, 0);
+	ASSERT_EQ(reinterpret_cast<uintptr_t>(large) % GraphArena::Alignment, 0);
+
+	// blocks of the same size class are handed out again
+	arena.Deallocate(small, 24);
+	arena.Deallocate(large, 5000);
+	ASSERT_EQ(arena.Allocate(32), small);
+	ASSERT_EQ(arena.Allocate(8000), large);
+	ASSERT_NE(arena.Allocate(24), small);
+
+	std::size_t reserved_size = arena.GetReservedSize();
+	arena.Release();
+	ASSERT_GT(reserved_size, 0);
+	ASSERT_EQ(arena.GetReservedSize(), 0);
+}
+
+TEST(GraphArenaTest, RemovedVerticesAreReused)
+{
+	Graph_t<ArenaTestState> graph;
+
+	for(uint64_t i = 0; i < 100; i++)
+	{
+		graph.AddEdge(ArenaTestState(i), ArenaTestState((i + 1) % 100), 1.0);
+		graph.AddEdge(ArenaTestState((i + 1) % 100), ArenaTestState(i), 1.0);
+	}
+
+	std::set<Vertex_t<ArenaTestState, double> *> removed;
+	for(uint64_t i = 0; i < 100; i += 10)
+	{
+		removed.insert(graph.GetVertexFromID(i));
+		graph.RemoveVertex(ArenaTestState(i));
+	}
+
+	// the new vertices take the memory of the removed ones
+	for(uint64_t i = 100; i < 110; i++)
+		ASSERT_EQ(removed.count(graph.AddVertex(ArenaTestState(i))), 1);
+
+	ASSERT_EQ(graph.GetVertexNumber(), 100);
+	ASSERT_EQ(graph.GetVertexFromID(1)->edges_to_.size(), 1);
+	ASSERT_EQ(graph.GetVertexFromID(5)->edges_to_.size(), 2);
+
+	graph.ClearGraph();
+	ASSERT_EQ(graph.GetVertexNumber(), 0);
+	graph.AddEdge(ArenaTestState(0), ArenaTestState(1), 1.0);
+	ASSERT_TRUE(graph.GetVertexFromID(0)->CheckNeighbour(graph.GetVertexFromID(1)));
+}
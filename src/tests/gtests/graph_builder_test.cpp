@@ -0,0 +1,99 @@
+/* 
+ * graph_builder_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <tuple>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/graph_builder.hpp"
+
+using namespace librav;
+
+struct BuilderCell
+{
+	BuilderCell(int32_t x, int32_t y):x_(x), y_(y){};
+
+	int32_t x_;
+	int32_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 64 + x_;
+	}
+};
+
+// 4-connected 64x64 grid with a blocked column at x = 20
+std::vector<std::tuple<BuilderCell, double>> GetGridNeighbours(BuilderCell cell)
+{
+	std::vector<std::tuple<BuilderCell, double>> neighbours;
+	const int32_t dx[] = {1, -1, 0, 0};
+	const int32_t dy[] = {0, 0, 1, -1};
+	for (int i = 0; i < 4; i++)
+	{
+		BuilderCell next(cell.x_ + dx[i], cell.y_ + dy[i]);
+		if (next.x_ >= 0 && next.x_ < 64 && next.y_ >= 0 && next.y_ < 64 && next.x_ != 20)
+			neighbours.emplace_back(next, 1.0 + i);
+	}
+	return neighbours;
+}
+
+TEST(GraphBuilderTest, SameGraphForAnyThreadNumber)
+{
+	std::vector<BuilderCell> cells;
+	for (int32_t y = 0; y < 64; y++)
+		for (int32_t x = 0; x < 64; x++)
+			if (x != 20)
+				cells.emplace_back(x, y);
+
+	Graph_t<BuilderCell> reference;
+	for (const auto &cell : cells)
+		for (const auto &neighbour : GetGridNeighbours(cell))
+			reference.AddEdge(cell, std::get<0>(neighbour), std::get<1>(neighbour));
+
+	for (std::size_t thread_num : {0, 1, 3, 8})
+	{
+		Graph_t<BuilderCell> graph;
+		std::size_t edge_num = AddGeneratedEdges(graph, cells, GetGridNeighbours, thread_num);
+
+		ASSERT_EQ(edge_num, reference.GetGraphEdges().size());
+		ASSERT_EQ(graph.GetVertexNumber(), reference.GetVertexNumber());
+		for (const auto &cell : cells)
+		{
+			auto vertex = graph.GetVertexFromID(cell.GetUniqueID());
+			auto ref_vertex = reference.GetVertexFromID(cell.GetUniqueID());
+			ASSERT_EQ(vertex->vertex_index_, ref_vertex->vertex_index_);
+			ASSERT_EQ(vertex->edges_to_.size(), ref_vertex->edges_to_.size());
+			for (std::size_t i = 0; i < vertex->edges_to_.size(); i++)
+			{
+				ASSERT_EQ(vertex->edges_to_[i].dst_->vertex_id_, ref_vertex->edges_to_[i].dst_->vertex_id_);
+				ASSERT_EQ(vertex->edges_to_[i].cost_, ref_vertex->edges_to_[i].cost_);
+			}
+		}
+	}
+}
+
+TEST(GraphBuilderTest, GeneratorException)
+{
+	std::vector<BuilderCell> cells;
+	for (int32_t y = 0; y < 8; y++)
+		for (int32_t x = 0; x < 64; x++)
+			cells.emplace_back(x, y);
+
+	Graph_t<BuilderCell> graph;
+	auto failing_generator = [](BuilderCell cell) {
+		if (cell.x_ == 50 && cell.y_ == 6)
+			throw std::runtime_error("collision checker failed");
+		return GetGridNeighbours(cell);
+	};
+	ASSERT_THROW(AddGeneratedEdges(graph, cells, failing_generator, 4), std::runtime_error);
+	ASSERT_EQ(graph.GetVertexNumber(), 0);
+}
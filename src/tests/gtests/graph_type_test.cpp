@@ -7,12 +7,11 @@
 
 #include <stdio.h>
 #include <vector>
+#include <limits>
 
 #include "gtest/gtest.h"
 
-#include "planning/graph/graph.h"
-#include "planning/graph/astar.h"
-#include "planning/graph/bds_example.h"
+#include "graph/graph.hpp"
 
 using namespace librav;
 
@@ -126,4 +125,196 @@ TEST_F(GraphTemplateTest, ConstRefType)
 	graph.AddEdge(*(nodes[8]), *(nodes[7]), 2.5);
 
 	ASSERT_NE(graph.GetGraphVertices().size(), 0) << "Failed to add a vertex of const reference type to the graph";
+
+	// the vertices refer to the states they were added with
+	for(int i = 0; i < 9; i++)
+	{
+		if(i == 6)
+			continue;
+		ASSERT_EQ(&graph.GetVertexFromID(i)->state_, nodes[i]);
+	}
+}
+
+TEST_F(GraphTemplateTest, UpdateEdgeCost)
+{
+	Graph_t<TestState*> graph;
+
+	graph.AddEdge((nodes[0]), (nodes[1]), 1.0);
+	graph.AddEdge((nodes[0]), (nodes[2]), 1.5);
+	graph.AddEdge((nodes[1]), (nodes[2]), 2.0);
+	graph.AddEdge((nodes[2]), (nodes[0]), 2.5);
+
+	ASSERT_TRUE(graph.UpdateEdgeCost(nodes[0], nodes[2], 3.0));
+	ASSERT_FALSE(graph.UpdateEdgeCost(nodes[2], nodes[1], 3.0)) << "Updated an edge that doesn't exist";
+	ASSERT_FALSE(graph.UpdateEdgeCost(nodes[0], nodes[8], 3.0)) << "Updated an edge to a vertex that doesn't exist";
+
+	auto v0 = graph.GetVertexFromID(0);
+	auto v2 = graph.GetVertexFromID(2);
+	ASSERT_EQ(v0->GetEdgeCost(*v2), 3.0);
+	for (auto &edge : v2->edges_from_)
+	{
+		if (edge.src_ == v0)
+		{
+			ASSERT_EQ(edge.cost_, 3.0) << "Predecessor copy of the edge not updated";
+		}
+	}
+
+	std::vector<std::tuple<TestState *, TestState *, double>> updates;
+	updates.emplace_back(nodes[0], nodes[1], 4.0);
+	updates.emplace_back(nodes[1], nodes[2], 5.0);
+	updates.emplace_back(nodes[1], nodes[0], 6.0);
+	ASSERT_EQ(graph.UpdateEdgeCosts(updates), 2);
+	ASSERT_EQ(v0->GetEdgeCost(*graph.GetVertexFromID(1)), 4.0);
+	ASSERT_EQ(graph.GetVertexFromID(1)->GetEdgeCost(*v2), 5.0);
+}
+
+TEST_F(GraphTemplateTest, RemoveEdgeKeepsIndex)
+{
+	Graph_t<TestState*> graph;
+
+	for (int i = 1; i < 9; i++)
+	{
+		graph.AddEdge(nodes[0], nodes[i], i);
+		graph.AddEdge(nodes[i], nodes[0], i);
+	}
+
+	// removing edges moves other edges within the lists, the moved edges must still be found
+	ASSERT_TRUE(graph.RemoveEdge(nodes[0], nodes[3]));
+	ASSERT_FALSE(graph.RemoveEdge(nodes[0], nodes[3]));
+	ASSERT_TRUE(graph.RemoveEdge(nodes[5], nodes[0]));
+	graph.RemoveVertex(nodes[1]);
+
+	auto v0 = graph.GetVertexFromID(0);
+	ASSERT_EQ(v0->edges_to_.size(), 6);
+	ASSERT_EQ(v0->edges_from_.size(), 6);
+	ASSERT_FALSE(v0->CheckNeighbour(graph.GetVertexFromID(3)));
+
+	for (int i = 2; i < 9; i++)
+	{
+		if (i != 3)
+		{
+			ASSERT_TRUE(graph.UpdateEdgeCost(nodes[0], nodes[i], 10.0 + i));
+		}
+		if (i != 5)
+		{
+			ASSERT_TRUE(graph.UpdateEdgeCost(nodes[i], nodes[0], 20.0 + i));
+		}
+	}
+	for (auto &edge : v0->edges_to_)
+		ASSERT_EQ(edge.cost_, 10.0 + edge.dst_->vertex_id_);
+	for (auto &edge : v0->edges_from_)
+		ASSERT_EQ(edge.cost_, 20.0 + edge.src_->vertex_id_);
+
+	// an edge can be added again after it was removed
+	graph.AddEdge(nodes[0], nodes[3], 1.0);
+	ASSERT_TRUE(graph.UpdateEdgeCost(nodes[0], nodes[3], 2.0));
+	ASSERT_EQ(v0->GetEdgeCost(*graph.GetVertexFromID(3)), 2.0);
+}
+
+TEST_F(GraphTemplateTest, EdgeIndexBuiltUpFront)
+{
+	// an index built on the empty graph is maintained by AddEdge() and AddEdges()
+	Graph_t<TestState*> graph;
+	graph.BuildEdgeIndex();
+	for (int i = 1; i < 5; i++)
+		graph.AddEdge(nodes[0], nodes[i], i);
+
+	std::vector<std::tuple<TestState *, TestState *, double>> edges;
+	for (int i = 5; i < 9; i++)
+		edges.emplace_back(nodes[i], nodes[0], i);
+	ASSERT_EQ(graph.AddEdges(edges), 4);
+
+	ASSERT_TRUE(graph.RemoveEdge(nodes[0], nodes[2]));
+	for (int i = 1; i < 9; i++)
+	{
+		if (i < 5)
+			ASSERT_EQ(graph.UpdateEdgeCost(nodes[0], nodes[i], 10.0 + i), i != 2);
+		else
+			ASSERT_TRUE(graph.UpdateEdgeCost(nodes[i], nodes[0], 10.0 + i));
+	}
+
+	auto v0 = graph.GetVertexFromID(0);
+	for (auto &edge : v0->edges_to_)
+		ASSERT_EQ(edge.cost_, 10.0 + edge.dst_->vertex_id_);
+	for (auto &edge : v0->edges_from_)
+		ASSERT_EQ(edge.cost_, 10.0 + edge.src_->vertex_id_);
+
+	// a missing edge has no finite cost
+	ASSERT_EQ(v0->GetEdgeCost(*graph.GetVertexFromID(2)), std::numeric_limits<double>::infinity());
+}
+
+TEST_F(GraphTemplateTest, AddEdgesSkipsDuplicates)
+{
+	Graph_t<TestState*> graph;
+	graph.Reserve(9, 16);
+	graph.AddEdge(nodes[0], nodes[1], 1.0);
+
+	std::vector<std::tuple<TestState *, TestState *, double>> edges;
+	edges.emplace_back(nodes[0], nodes[2], 2.0);
+	edges.emplace_back(nodes[0], nodes[1], 5.0);
+	edges.emplace_back(nodes[3], nodes[0], 3.0);
+	edges.emplace_back(nodes[0], nodes[2], 6.0);
+	edges.emplace_back(nodes[2], nodes[0], 2.0);
+	for (int i = 4; i < 9; i++)
+		edges.emplace_back(nodes[0], nodes[i], i);
+
+	// existing edges and repeated edges keep their first cost
+	ASSERT_EQ(graph.AddEdges(edges), 8);
+	ASSERT_EQ(graph.GetVertexNumber(), 9);
+
+	auto v0 = graph.GetVertexFromID(0);
+	ASSERT_EQ(v0->edges_to_.size(), 7);
+	ASSERT_EQ(v0->edges_from_.size(), 2);
+	ASSERT_EQ(v0->GetEdgeCost(*graph.GetVertexFromID(1)), 1.0);
+	ASSERT_EQ(v0->GetEdgeCost(*graph.GetVertexFromID(2)), 2.0);
+	for (int i = 4; i < 9; i++)
+		ASSERT_EQ(graph.GetVertexFromID(i)->edges_from_.size(), 1);
+
+	// with the edge index built, the batch is checked against the index
+	ASSERT_TRUE(graph.UpdateEdgeCost(nodes[0], nodes[8], 10.0));
+	edges.emplace_back(nodes[8], nodes[0], 8.0);
+	ASSERT_EQ(graph.AddEdges(edges), 1);
+	ASSERT_TRUE(graph.UpdateEdgeCost(nodes[8], nodes[0], 9.0));
+	ASSERT_EQ(graph.GetVertexFromID(8)->GetEdgeCost(*v0), 9.0);
+	ASSERT_TRUE(graph.RemoveEdge(nodes[0], nodes[4]));
+	ASSERT_EQ(v0->edges_to_.size(), 6);
+}
+
+TEST_F(GraphTemplateTest, AddEdgesDenseBatch)
+{
+	// a dense batch is grouped by source part way through, duplicates of the edges added
+	//	before that are still skipped
+	Graph_t<TestState> graph;
+	std::vector<std::tuple<TestState, TestState, double>> edges;
+	for (int round = 0; round < 2; round++)
+		for (int i = 1; i <= 40; i++)
+			edges.emplace_back(TestState(0), TestState(i), round * 100.0 + i);
+	for (int i = 1; i <= 40; i++)
+		edges.emplace_back(TestState(i), TestState(0), i);
+
+	ASSERT_EQ(graph.AddEdges(edges), 80);
+	ASSERT_EQ(graph.GetVertexNumber(), 41);
+
+	auto v0 = graph.GetVertexFromID(0);
+	ASSERT_EQ(v0->edges_to_.size(), 40);
+	ASSERT_EQ(v0->edges_from_.size(), 40);
+	for (auto &edge : v0->edges_to_)
+	{
+		ASSERT_EQ(edge.cost_, edge.dst_->vertex_id_);
+		ASSERT_EQ(edge.dst_->edges_from_.size(), 1);
+	}
+}
+
+TEST_F(GraphTemplateTest, UndirectedEdge)
+{
+	Graph_t<TestState*> graph;
+
+	graph.AddUndirectedEdge(nodes[0], nodes[1], 1.5);
+	ASSERT_EQ(graph.GetVertexFromID(0)->GetEdgeCost(*graph.GetVertexFromID(1)), 1.5);
+	ASSERT_EQ(graph.GetVertexFromID(1)->GetEdgeCost(*graph.GetVertexFromID(0)), 1.5);
+	ASSERT_EQ(graph.GetGraphUndirectedEdges().size(), 1);
+
+	ASSERT_TRUE(graph.RemoveUndirectedEdge(nodes[1], nodes[0]));
+	ASSERT_FALSE(graph.RemoveUndirectedEdge(nodes[0], nodes[1]));
+	ASSERT_TRUE(graph.GetGraphEdges().empty());
 }
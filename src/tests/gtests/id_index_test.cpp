@@ -0,0 +1,217 @@
+/* 
+ * id_index_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct IndexState
+{
+	IndexState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+TEST(IDIndexTest, FlatMapMatchesStdMap)
+{
+	FlatIDMap<uint64_t> flat_map;
+	std::unordered_map<uint64_t, uint64_t> std_map;
+	std::mt19937_64 rng(3);
+
+	// small key range so that inserts, erases and lookups hit existing keys
+	for(int i = 0; i < 100000; i++)
+	{
+		uint64_t key = (rng() % 5000) * 1024;
+		switch(rng() % 3)
+		{
+			case 0:
+			{
+				bool inserted = flat_map.insert(key, i).second;
+				ASSERT_EQ(inserted, std_map.insert(std::make_pair(key, i)).second);
+				break;
+			}
+			case 1:
+				ASSERT_EQ(flat_map.erase(key), std_map.erase(key) > 0);
+				break;
+			default:
+			{
+				uint64_t *value = flat_map.find(key);
+				auto it = std_map.find(key);
+				ASSERT_EQ(value != nullptr, it != std_map.end());
+				if(value != nullptr)
+				{
+					ASSERT_EQ(*value, it->second);
+				}
+			}
+		}
+		ASSERT_EQ(flat_map.size(), std_map.size());
+	}
+
+	for(auto &entry : std_map)
+		ASSERT_EQ(*flat_map.find(entry.first), entry.second);
+
+	flat_map.clear();
+	ASSERT_TRUE(flat_map.empty());
+	ASSERT_EQ(flat_map.find(std_map.begin()->first), nullptr);
+}
+
+TEST(IDIndexTest, ReserveKeepsEntries)
+{
+	FlatIDMap<int> map;
+	for(int i = 0; i < 100; i++)
+		map.insert(i, i);
+	map.reserve(10000);
+	for(int i = 0; i < 100; i++)
+		ASSERT_EQ(*map.find(i), i);
+	ASSERT_EQ(map.find(100), nullptr);
+}
+
+TEST(IDIndexTest, GraphWithStdIndex)
+{
+	Graph_t<IndexState, double, StdIDIndex> graph;
+
+	for(uint64_t i = 0; i < 50; i++)
+		graph.AddEdge(IndexState(i), IndexState(i + 1), 1.0);
+	graph.RemoveVertex(IndexState(10));
+
+	ASSERT_EQ(graph.GetVertexNumber(), 50);
+	ASSERT_EQ(graph.GetVertexFromID(10), nullptr);
+	ASSERT_EQ(graph.GetVertexFromID(11)->vertex_id_, 11);
+	ASSERT_TRUE(graph.UpdateEdgeCost(IndexState(20), IndexState(21), 2.0));
+}
+
+TEST(IDIndexTest, DenseMap)
+{
+	DenseIDMap<int> map;
+	map.reserve(10);
+
+	ASSERT_TRUE(map.insert(3, 30).second);
+	ASSERT_FALSE(map.insert(3, 31).second);
+	ASSERT_TRUE(map.insert(25, 250).second) << "Failed to insert an id beyond the reserved range";
+	ASSERT_EQ(map.size(), 2);
+	ASSERT_EQ(*map.find(3), 30);
+	ASSERT_EQ(*map.find(25), 250);
+	ASSERT_EQ(map.find(4), nullptr);
+	ASSERT_EQ(map.find(1000), nullptr);
+
+	ASSERT_TRUE(map.erase(3));
+	ASSERT_FALSE(map.erase(3));
+	ASSERT_EQ(map.find(3), nullptr);
+	ASSERT_EQ(map.size(), 1);
+
+	// ids beyond the bound are rejected and leave the map as it was
+	ASSERT_THROW(map.insert(std::numeric_limits<uint64_t>::max(), 1), std::out_of_range);
+	ASSERT_THROW(map.insert(DenseIDMap<int>::MaxID + 1, 1), std::out_of_range);
+	ASSERT_THROW(map.reserve(DenseIDMap<int>::MaxID + 2), std::out_of_range);
+	ASSERT_EQ(map.size(), 1);
+	ASSERT_EQ(*map.find(25), 250);
+	ASSERT_EQ(map.find(std::numeric_limits<uint64_t>::max()), nullptr);
+}
+
+TEST(IDIndexTest, GraphWithDenseIndex)
+{
+	Graph_t<IndexState, double, DenseIDIndex> graph;
+	graph.ReserveIDRange(100);
+
+	for(uint64_t i = 0; i < 99; i++)
+		graph.AddEdge(IndexState(i), IndexState(i + 1), 1.0);
+	graph.RemoveVertex(IndexState(10));
+
+	ASSERT_EQ(graph.GetVertexNumber(), 99);
+	ASSERT_EQ(graph.GetVertexFromID(10), nullptr);
+	ASSERT_EQ(graph.GetVertexFromID(99)->vertex_id_, 99);
+	ASSERT_TRUE(graph.GetVertexFromID(20)->CheckNeighbour(graph.GetVertexFromID(21)));
+
+	// the algorithms and snapshots work with any id index
+	ASSERT_EQ(Dijkstra::Search(graph, 20, 30).size(), 11);
+	ASSERT_EQ(graph.Freeze().GetVertexNumber(), 99);
+}
+
+TEST(IDIndexTest, GraphMemorySize)
+{
+	Graph_t<IndexState> flat_graph;
+	Graph_t<IndexState, double, StdIDIndex> std_graph;
+	Graph_t<IndexState, double, DenseIDIndex> dense_graph;
+	ASSERT_EQ(flat_graph.GetMemorySize(), 0);
+	ASSERT_EQ(dense_graph.GetMemorySize(), 0);
+
+	// the dense id table is counted once it's allocated
+	dense_graph.ReserveIDRange(1000);
+	ASSERT_GE(dense_graph.GetMemorySize(), 1000 * sizeof(void *));
+
+	for(uint64_t i = 0; i < 99; i++)
+	{
+		flat_graph.AddEdge(IndexState(i), IndexState(i + 1), 1.0);
+		std_graph.AddEdge(IndexState(i), IndexState(i + 1), 1.0);
+	}
+	ASSERT_GT(flat_graph.GetMemorySize(), 100 * sizeof(Graph_t<IndexState>::VertexType));
+	ASSERT_GT(std_graph.GetMemorySize(), 100 * sizeof(Graph_t<IndexState>::VertexType));
+}
+
+// counts its live copies, a vertex keeps one
+struct CountedState
+{
+	CountedState(uint64_t id):id_(id){ ++live_num; };
+	CountedState(const CountedState &other):id_(other.id_){ ++live_num; };
+	~CountedState(){ --live_num; };
+
+	static int live_num;
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+int CountedState::live_num = 0;
+
+TEST(IDIndexTest, RejectedIDLeavesGraphUnchanged)
+{
+	Graph_t<IndexState, double, DenseIDIndex> graph;
+	graph.ReserveIDRange(16);
+	graph.Reserve(16, 16);
+	graph.AddEdge(IndexState(1), IndexState(2), 1.0);
+	std::size_t memory_size = graph.GetMemorySize();
+
+	// a rejected id doesn't change the vertices, the indices or the memory of the graph
+	ASSERT_THROW(graph.AddVertex(IndexState(DenseIDMap<int>::MaxID + 1)), std::out_of_range);
+	ASSERT_THROW(graph.AddEdge(IndexState(1), IndexState(DenseIDMap<int>::MaxID + 1), 1.0), std::out_of_range);
+	ASSERT_EQ(graph.GetVertexNumber(), 2);
+	ASSERT_EQ(graph.GetVertexIndexBound(), 2);
+	ASSERT_EQ(graph.GetMemorySize(), memory_size);
+	ASSERT_EQ(graph.GetVertexFromID(1)->edges_to_.size(), 1);
+
+	graph.AddEdge(IndexState(2), IndexState(3), 1.0);
+	ASSERT_EQ(graph.GetVertexNumber(), 3);
+	ASSERT_EQ(graph.GetMemorySize(), memory_size);
+
+	// the vertex built for the rejected id is destroyed as well
+	{
+		Graph_t<CountedState, double, DenseIDIndex> counted_graph;
+		counted_graph.AddVertex(CountedState(1));
+		ASSERT_EQ(CountedState::live_num, 1);
+		ASSERT_THROW(counted_graph.AddVertex(CountedState(DenseIDMap<int>::MaxID + 1)), std::out_of_range);
+		ASSERT_EQ(CountedState::live_num, 1);
+	}
+	ASSERT_EQ(CountedState::live_num, 0);
+}
@@ -0,0 +1,143 @@
+/* 
+ * landmark_table_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/landmark_table.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct AltTestState
+{
+	AltTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+struct LandmarkTableTest: testing::Test
+{
+	Graph_t<AltTestState> graph;
+	std::mt19937 gen;
+	std::uniform_int_distribution<uint64_t> vertex_dist;
+
+	LandmarkTableTest(): gen(3), vertex_dist(0, 299)
+	{
+		// a random directed graph with integer costs
+		std::uniform_int_distribution<int> cost_dist(1, 20);
+		for(int i = 0; i < 1200; i++)
+			graph.AddEdge(AltTestState(vertex_dist(gen)), AltTestState(vertex_dist(gen)), cost_dist(gen));
+	}
+};
+
+TEST_F(LandmarkTableTest, LowerBound)
+{
+	LandmarkTable_t<AltTestState, double, uint32_t> table(graph, 8);
+	ASSERT_EQ(table.GetLandmarkNumber(), 8);
+
+	auto heuristic = table.GetHeuristic();
+	SearchContext context;
+	for(int k = 0; k < 20; k++)
+	{
+		uint64_t goal = vertex_dist(gen);
+		auto goal_vtx = graph.GetVertexFromID(goal);
+		if(goal_vtx == nullptr)
+			continue;
+
+		// the heuristic never overestimates the distance to the goal
+		for(auto vtx : graph.GetGraphVertices())
+		{
+			Dijkstra::Search(graph, context, vtx, goal_vtx);
+			if(context.IsVisited(goal_vtx->vertex_index_))
+			{
+				ASSERT_LE(heuristic(vtx->state_, goal_vtx->state_), context.GetSearchInfo(goal_vtx->vertex_index_).g_astar_);
+			}
+		}
+	}
+}
+
+TEST_F(LandmarkTableTest, Search)
+{
+	LandmarkTable_t<AltTestState> table(graph, 8);
+
+	SearchContext context;
+	SearchContext alt_context;
+	for(int k = 0; k < 100; k++)
+	{
+		uint64_t start = vertex_dist(gen);
+		uint64_t goal = vertex_dist(gen);
+		if(graph.GetVertexFromID(start) == nullptr || graph.GetVertexFromID(goal) == nullptr)
+			continue;
+
+		auto path = Dijkstra::Search(graph, context, start, goal);
+		auto alt_path = AStar::Search(graph, alt_context, start, goal, table.GetHeuristic());
+		auto active_path = AStar::Search(graph, alt_context, start, goal, table.GetHeuristic(start, goal, 2));
+		ASSERT_EQ(alt_path.empty(), path.empty());
+		ASSERT_EQ(active_path.empty(), path.empty());
+		if(path.empty())
+			continue;
+
+		uint32_t goal_idx = graph.GetVertexFromID(goal)->vertex_index_;
+		ASSERT_DOUBLE_EQ(alt_context.GetSearchInfo(goal_idx).g_astar_, context.GetSearchInfo(goal_idx).g_astar_);
+	}
+
+	ASSERT_EQ(table.GetHeuristic(0, 1, 2).GetLandmarks().size(), 2);
+}
+
+template <typename TableType>
+void CheckRealValuedCosts()
+{
+	// a random directed graph with real-valued costs, which are rounded when stored as float
+	Graph_t<AltTestState> graph;
+	std::mt19937 gen(9);
+	std::uniform_int_distribution<uint64_t> vertex_dist(0, 199);
+	std::uniform_real_distribution<double> cost_dist(0.1, 30.0);
+	for(int i = 0; i < 1000; i++)
+		graph.AddEdge(AltTestState(vertex_dist(gen)), AltTestState(vertex_dist(gen)), cost_dist(gen));
+
+	TableType table(graph, 8);
+	auto heuristic = table.GetHeuristic();
+	SearchContext context, alt_context;
+	for(int k = 0; k < 20; k++)
+	{
+		auto goal_vtx = graph.GetVertexFromID(vertex_dist(gen));
+		if(goal_vtx == nullptr)
+			continue;
+
+		for(auto vtx : graph.GetGraphVertices())
+		{
+			Dijkstra::Search(graph, context, vtx, goal_vtx);
+			if(!context.IsVisited(goal_vtx->vertex_index_))
+				continue;
+
+			// the bound is admissible up to the rounding of the path costs themselves
+			double distance = context.GetSearchInfo(goal_vtx->vertex_index_).g_astar_;
+			ASSERT_LE(heuristic(vtx->state_, goal_vtx->state_), distance * (1 + 1e-12));
+
+			AStar::Search(graph, alt_context, vtx, goal_vtx, heuristic);
+			ASSERT_DOUBLE_EQ(alt_context.GetSearchInfo(goal_vtx->vertex_index_).g_astar_, distance);
+		}
+	}
+}
+
+TEST(LandmarkTableCostTest, RealValuedCosts)
+{
+	CheckRealValuedCosts<LandmarkTable_t<AltTestState>>();
+	CheckRealValuedCosts<LandmarkTable_t<AltTestState, double, float>>();
+}
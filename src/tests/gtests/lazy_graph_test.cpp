@@ -0,0 +1,116 @@
+/* 
+ * lazy_graph_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <tuple>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "graph/lazy_graph.hpp"
+#include "graph/algorithms/astar.hpp"
+
+using namespace librav;
+
+struct LatticeState
+{
+	LatticeState(int32_t x, int32_t y):x_(x), y_(y){};
+
+	int32_t x_;
+	int32_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		// unbounded lattice, pack both coordinates
+		return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(x_)) << 32) | static_cast<uint32_t>(y_));
+	}
+};
+
+struct LatticeNeighbour
+{
+	int* call_count;
+
+	std::vector<std::tuple<LatticeState, double>> operator()(LatticeState state)
+	{
+		++(*call_count);
+
+		// a wall at x = 5 for y < 10
+		std::vector<std::tuple<LatticeState, double>> neighbours;
+		const int32_t dx[4] = {1, -1, 0, 0};
+		const int32_t dy[4] = {0, 0, 1, -1};
+		for(int i = 0; i < 4; i++)
+		{
+			LatticeState next(state.x_ + dx[i], state.y_ + dy[i]);
+			if(next.x_ == 5 && next.y_ < 10)
+				continue;
+			neighbours.emplace_back(next, 1.0);
+		}
+		return neighbours;
+	}
+};
+
+double LatticeManhattan(const LatticeState& a, const LatticeState& b)
+{
+	return std::abs(a.x_ - b.x_) + std::abs(a.y_ - b.y_);
+}
+
+TEST(LazyGraphTest, IncSearch)
+{
+	int call_count = 0;
+	LazyGraph_t<LatticeState> graph(LatticeNeighbour{&call_count});
+
+	// 10 steps around the wall and 10 steps back down
+	auto path = AStar::IncSearch(graph, LatticeState(0, 0), LatticeState(10, 0), LatticeManhattan);
+	ASSERT_EQ(path.size(), 31);
+	ASSERT_EQ(path.back().GetUniqueID(), LatticeState(10, 0).GetUniqueID());
+	ASSERT_GT(call_count, 0);
+
+	// the second query reuses the expanded vertices
+	int first_count = call_count;
+	auto second_path = AStar::IncSearch(graph, LatticeState(0, 0), LatticeState(10, 0), LatticeManhattan);
+	ASSERT_EQ(second_path.size(), 31);
+	ASSERT_EQ(call_count, first_count);
+
+	// a search without cache gives the same result
+	auto plain_path = AStar::IncSearch(LatticeState(0, 0), LatticeState(10, 0), LatticeNeighbour{&call_count}, LatticeManhattan);
+	ASSERT_EQ(plain_path.size(), 31);
+}
+
+TEST(LazyGraphTest, CacheCap)
+{
+	int call_count = 0;
+	LazyGraph_t<LatticeState> graph(LatticeNeighbour{&call_count}, 100);
+
+	bool evicted = false;
+	for(int32_t k = 0; k < 10; k++)
+	{
+		auto path = AStar::IncSearch(graph, LatticeState(k * 20, 0), LatticeState(k * 20 + 10, 0), LatticeManhattan);
+		if(k * 20 < 5 && k * 20 + 10 > 5)
+			ASSERT_EQ(path.size(), 31);
+		else
+			ASSERT_EQ(path.size(), 11);
+
+		// the cap is only enforced when a query begins: a cache above the cap is evicted
+		//	down to half of it, a cache within the cap is kept
+		std::size_t vertex_num = graph.GetVertexNumber();
+		graph.BeginQuery();
+		if(vertex_num > 100)
+		{
+			ASSERT_LE(graph.GetVertexNumber(), 100 / 2);
+			evicted = true;
+		}
+		else
+			ASSERT_EQ(graph.GetVertexNumber(), vertex_num);
+	}
+	ASSERT_TRUE(evicted);
+
+	// searching the evicted region again regenerates it
+	auto path = AStar::IncSearch(graph, LatticeState(0, 0), LatticeState(10, 0), LatticeManhattan);
+	ASSERT_EQ(path.size(), 31);
+}
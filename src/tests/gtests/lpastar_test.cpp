@@ -0,0 +1,96 @@
+/* 
+ * lpastar_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+#include "graph/algorithms/lpastar.hpp"
+
+using namespace librav;
+
+struct LpaTestState
+{
+	LpaTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+double LpaZeroHeuristic(LpaTestState, LpaTestState)
+{
+	return 0.0;
+}
+
+template <typename PathType>
+double GetLpaPathCost(const PathType& path)
+{
+	double cost = 0;
+	for(std::size_t i = 0; i + 1 < path.size(); ++i)
+		cost += path[i]->GetEdgeCost(*path[i + 1]);
+	return cost;
+}
+
+TEST(LPAStarTest, Replan)
+{
+	Graph_t<LpaTestState> graph;
+	std::vector<std::pair<uint64_t, uint64_t>> edges;
+
+	std::mt19937 gen(5);
+	std::uniform_int_distribution<uint64_t> vertex_dist(0, 199);
+	std::uniform_int_distribution<int> cost_dist(1, 20);
+	for(int i = 0; i < 1000; i++)
+	{
+		uint64_t src = vertex_dist(gen);
+		uint64_t dst = vertex_dist(gen);
+		graph.AddEdge(LpaTestState(src), LpaTestState(dst), cost_dist(gen));
+		edges.emplace_back(src, dst);
+	}
+
+	// pick a start and a goal that are connected
+	uint64_t start = edges.front().first;
+	uint64_t goal = edges.back().second;
+
+	LPAStar<LpaTestState> lpastar(graph, LpaZeroHeuristic);
+	ASSERT_TRUE(lpastar.SetStartGoal(start, goal));
+
+	SearchContext context;
+	std::uniform_int_distribution<std::size_t> edge_dist(0, edges.size() - 1);
+	for(int k = 0; k < 50; k++)
+	{
+		auto path = lpastar.ComputeShortestPath();
+		auto reference = Dijkstra::Search(graph, context, start, goal);
+
+		ASSERT_EQ(path.empty(), reference.empty());
+		if(!path.empty())
+		{
+			ASSERT_DOUBLE_EQ(GetLpaPathCost(path), GetLpaPathCost(reference));
+			ASSERT_DOUBLE_EQ(lpastar.GetPathCost(), GetLpaPathCost(reference));
+			ASSERT_EQ(path.front()->vertex_id_, start);
+			ASSERT_EQ(path.back()->vertex_id_, goal);
+		}
+
+		// change a few edges, both cheaper and more expensive, and remove one
+		for(int i = 0; i < 3; i++)
+		{
+			auto& edge = edges[edge_dist(gen)];
+			lpastar.UpdateEdgeCost(LpaTestState(edge.first), LpaTestState(edge.second), cost_dist(gen));
+		}
+		auto& removed = edges[edge_dist(gen)];
+		if(graph.RemoveEdge(LpaTestState(removed.first), LpaTestState(removed.second)))
+			lpastar.NotifyEdgeChange(LpaTestState(removed.second));
+	}
+}
@@ -0,0 +1,229 @@
+/* 
+ * open_list_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+TEST(OpenListTest, IndexedHeapOrder)
+{
+	IndexedDaryHeap<4> heap;
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<double> dist(0.0, 100.0);
+
+	std::vector<double> priority(500);
+	for(uint32_t i = 0; i < priority.size(); i++)
+	{
+		priority[i] = dist(rng);
+		heap.put(i, priority[i]);
+	}
+
+	// decrease half of the keys, the heap must not grow
+	for(uint32_t i = 0; i < priority.size(); i += 2)
+	{
+		priority[i] /= 2.0;
+		heap.put(i, priority[i]);
+	}
+	ASSERT_EQ(heap.size(), priority.size());
+	ASSERT_TRUE(heap.contains(10));
+
+	double last = -1.0;
+	while(!heap.empty())
+	{
+		uint32_t item = heap.get();
+		ASSERT_GE(priority[item], last);
+		ASSERT_FALSE(heap.contains(item));
+		last = priority[item];
+	}
+}
+
+template <typename OpenListType>
+void CheckMonotoneQueue()
+{
+	OpenListType queue;
+	std::mt19937 rng(11);
+	std::uniform_int_distribution<int> step(0, 200);
+
+	// emulate a Dijkstra run: new keys are never below the last popped key
+	std::vector<double> keys;
+	double last = 0.0;
+	for(int i = 0; i < 50; i++)
+	{
+		keys.push_back(step(rng));
+		queue.put(keys.size() - 1, keys.back());
+	}
+	while(!queue.empty())
+	{
+		std::size_t size = queue.size();
+		double key = keys[queue.get()];
+		ASSERT_EQ(queue.size(), size - 1);
+		ASSERT_GE(key, last);
+		last = key;
+		if(keys.size() < 2000)
+		{
+			for(int k = 0; k < 2; k++)
+			{
+				keys.push_back(last + step(rng));
+				queue.put(keys.size() - 1, keys.back());
+			}
+		}
+	}
+
+	// pops are ordered
+	OpenListType fresh_queue;
+	std::vector<double> fresh_keys = {5, 3, 9, 3, 0, 17, 1024, 65, 2};
+	for(uint32_t i = 0; i < fresh_keys.size(); i++)
+		fresh_queue.put(i, fresh_keys[i]);
+	std::vector<double> popped;
+	while(!fresh_queue.empty())
+		popped.push_back(fresh_keys[fresh_queue.get()]);
+	std::sort(fresh_keys.begin(), fresh_keys.end());
+	ASSERT_EQ(popped, fresh_keys);
+}
+
+TEST(OpenListTest, MonotoneQueueOrder)
+{
+	CheckMonotoneQueue<RadixHeap<double>>();
+	CheckMonotoneQueue<RadixHeap<uint32_t>>();
+	CheckMonotoneQueue<BucketQueue<double>>();
+}
+
+TEST(OpenListTest, SearchResults)
+{
+	struct RandomState
+	{
+		RandomState(int64_t id):id_(id){};
+		int64_t id_;
+		int64_t GetUniqueID() const { return id_; }
+	};
+
+	Graph_t<RandomState> graph;
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int64_t> vtx(0, 199);
+	std::uniform_int_distribution<int> cost(1, 10);
+	for(int i = 0; i < 2000; i++)
+		graph.AddEdge(RandomState(vtx(rng)), RandomState(vtx(rng)), cost(rng));
+
+	auto csr = graph.Freeze();
+	SearchContext pq_context, heap_context, radix_context, bucket_context;
+	for(int64_t goal = 1; goal < 200; goal += 7)
+	{
+		auto pq_path = Dijkstra::Search(csr, pq_context, 0, goal);
+		auto heap_path = Dijkstra::Search<IndexedDaryHeap<4>>(csr, heap_context, 0, goal);
+		auto radix_path = Dijkstra::Search<RadixHeap<double>>(csr, radix_context, 0, goal);
+		auto bucket_path = Dijkstra::Search<BucketQueue<double>>(csr, bucket_context, 0, goal);
+		ASSERT_EQ(pq_path.empty(), heap_path.empty());
+		ASSERT_EQ(pq_path.empty(), radix_path.empty());
+		ASSERT_EQ(pq_path.empty(), bucket_path.empty());
+		if(!pq_path.empty())
+		{
+			double cost = pq_context.GetSearchInfo(pq_path.back()).g_astar_;
+			ASSERT_DOUBLE_EQ(cost, heap_context.GetSearchInfo(heap_path.back()).g_astar_);
+			ASSERT_DOUBLE_EQ(cost, radix_context.GetSearchInfo(radix_path.back()).g_astar_);
+			ASSERT_DOUBLE_EQ(cost, bucket_context.GetSearchInfo(bucket_path.back()).g_astar_);
+		}
+	}
+}
+
+TEST(OpenListTest, BucketQueueFractionalCosts)
+{
+	struct RandomState
+	{
+		RandomState(int64_t id):id_(id){};
+		int64_t id_;
+		int64_t GetUniqueID() const { return id_; }
+	};
+
+	// costs below 1 put many vertices with different priorities into the same bucket
+	Graph_t<RandomState> graph;
+	std::mt19937 rng(5);
+	std::uniform_int_distribution<int64_t> vtx(0, 199);
+	std::uniform_real_distribution<double> cost(0.05, 1.5);
+	for(int i = 0; i < 2000; i++)
+		graph.AddEdge(RandomState(vtx(rng)), RandomState(vtx(rng)), cost(rng));
+
+	auto csr = graph.Freeze();
+	SearchContext pq_context, bucket_context;
+	for(int64_t goal = 1; goal < 200; goal += 3)
+	{
+		auto pq_path = Dijkstra::Search(csr, pq_context, 0, goal);
+		auto bucket_path = Dijkstra::Search<BucketQueue<double>>(csr, bucket_context, 0, goal);
+		ASSERT_EQ(pq_path.empty(), bucket_path.empty());
+		if(!pq_path.empty())
+		{
+			ASSERT_DOUBLE_EQ(pq_context.GetSearchInfo(pq_path.back()).g_astar_,
+							 bucket_context.GetSearchInfo(bucket_path.back()).g_astar_);
+		}
+	}
+}
+
+TEST(OpenListTest, BucketQueueLargeCosts)
+{
+	// keys far beyond the window wait in the overflow heap instead of growing the buckets
+	BucketQueue<double> queue;
+	std::vector<double> keys = {1e18, 5e9, 3, 1e300, 70000.5, 2.5, 5e9 + 1, 70000.25, 1e18};
+	for(uint32_t i = 0; i < keys.size(); i++)
+		queue.put(i, keys[i]);
+	std::vector<double> popped;
+	while(popped.size() < 4)
+		popped.push_back(keys[queue.get()]);
+
+	// later keys within and beyond the moved window
+	keys.push_back(70001);
+	queue.put(keys.size() - 1, keys.back());
+	keys.push_back(5e9 + 0.5);
+	queue.put(keys.size() - 1, keys.back());
+	while(!queue.empty())
+		popped.push_back(keys[queue.get()]);
+	std::sort(keys.begin(), keys.end());
+	ASSERT_EQ(popped, keys);
+
+	struct RandomState
+	{
+		RandomState(int64_t id):id_(id){};
+		int64_t id_;
+		int64_t GetUniqueID() const { return id_; }
+	};
+
+	// a graph with small costs and a few huge ones
+	Graph_t<RandomState> graph;
+	std::mt19937 rng(9);
+	std::uniform_int_distribution<int64_t> vtx(0, 199);
+	std::uniform_int_distribution<int> cost(1, 10);
+	for(int i = 0; i < 2000; i++)
+		graph.AddEdge(RandomState(vtx(rng)), RandomState(vtx(rng)), (i % 100 == 0) ? 1e12 + i : cost(rng));
+	graph.AddEdge(RandomState(0), RandomState(200), 1e15);
+
+	auto csr = graph.Freeze();
+	SearchContext pq_context, bucket_context;
+	for(int64_t goal = 1; goal < 200; goal += 3)
+	{
+		auto pq_path = Dijkstra::Search(csr, pq_context, 0, goal);
+		auto bucket_path = Dijkstra::Search<BucketQueue<double>>(csr, bucket_context, 0, goal);
+		ASSERT_EQ(pq_path.empty(), bucket_path.empty());
+		if(!pq_path.empty())
+		{
+			ASSERT_DOUBLE_EQ(pq_context.GetSearchInfo(pq_path.back()).g_astar_,
+							 bucket_context.GetSearchInfo(bucket_path.back()).g_astar_);
+		}
+	}
+
+	// vertex 200 is only reached through the edge of cost 1e15
+	auto far_path = Dijkstra::Search<BucketQueue<double>>(csr, bucket_context, 0, 200);
+	ASSERT_EQ(far_path.size(), 2);
+	ASSERT_DOUBLE_EQ(bucket_context.GetSearchInfo(far_path.back()).g_astar_, 1e15);
+}
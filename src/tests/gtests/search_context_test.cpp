@@ -0,0 +1,281 @@
+/* 
+ * search_context_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct GridState
+{
+	GridState(int32_t x, int32_t y):x_(x), y_(y){};
+
+	int32_t x_;
+	int32_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 32 + x_;
+	}
+};
+
+double GridManhattan(GridState node1, GridState node2)
+{
+	return std::abs(node1.x_ - node2.x_) + std::abs(node1.y_ - node2.y_);
+}
+
+struct SearchContextTest: testing::Test
+{
+	Graph_t<GridState> graph;
+
+	SearchContextTest()
+	{
+		// 32x32 4-connected grid with a wall at x = 16 except at y = 31
+		for(int32_t y = 0; y < 32; y++)
+			for(int32_t x = 0; x < 32; x++)
+			{
+				if(x == 16 && y != 31)
+					continue;
+				if(x + 1 < 32 && !(x + 1 == 16 && y != 31))
+				{
+					graph.AddEdge(GridState(x, y), GridState(x + 1, y), 1.0);
+					graph.AddEdge(GridState(x + 1, y), GridState(x, y), 1.0);
+				}
+				if(y + 1 < 32 && !(x == 16 && y + 1 != 31))
+				{
+					graph.AddEdge(GridState(x, y), GridState(x, y + 1), 1.0);
+					graph.AddEdge(GridState(x, y + 1), GridState(x, y), 1.0);
+				}
+			}
+	}
+};
+
+TEST_F(SearchContextTest, ConcurrentSearch)
+{
+	const Graph_t<GridState>& shared_graph = graph;
+	auto reference = AStar::Search(graph, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+	ASSERT_EQ(reference.size(), 94);
+
+	std::vector<std::size_t> astar_lengths(4, 0);
+	std::vector<std::size_t> dijkstra_lengths(4, 0);
+	std::vector<std::thread> workers;
+	for(int i = 0; i < 4; i++)
+	{
+		workers.emplace_back([&, i]() {
+			SearchContext context;
+			for(int k = 0; k < 10; k++)
+			{
+				astar_lengths[i] = AStar::Search(shared_graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan)).size();
+				dijkstra_lengths[i] = Dijkstra::Search(shared_graph, context, 0, 31).size();
+			}
+		});
+	}
+	for(auto& worker : workers)
+		worker.join();
+
+	for(int i = 0; i < 4; i++)
+	{
+		ASSERT_EQ(astar_lengths[i], reference.size());
+		ASSERT_EQ(dijkstra_lengths[i], reference.size());
+	}
+}
+
+TEST_F(SearchContextTest, VertexIndexReuse)
+{
+	auto removed = graph.GetVertexFromID(GridState(3, 3).GetUniqueID());
+	uint32_t removed_index = removed->vertex_index_;
+	std::size_t bound = graph.GetVertexIndexBound();
+
+	graph.RemoveVertex(GridState(3, 3));
+	ASSERT_EQ(graph.GetVertexFromIndex(removed_index), nullptr);
+
+	graph.AddEdge(GridState(3, 3), GridState(3, 4), 1.0);
+	ASSERT_EQ(graph.GetVertexFromID(GridState(3, 3).GetUniqueID())->vertex_index_, removed_index);
+	ASSERT_EQ(graph.GetVertexIndexBound(), bound);
+
+	SearchContext context;
+	auto path = AStar::Search(graph, context, GridState(3, 3).GetUniqueID(), 0, CalcHeuristicFunc_t<GridState>(GridManhattan));
+	ASSERT_EQ(path.size(), 9);
+	ASSERT_EQ(context.GetSearchInfo(path.back()->vertex_index_).g_astar_, 8.0);
+}
+
+TEST_F(SearchContextTest, LazyReset)
+{
+	SearchContext context;
+
+	// a short query only touches a few vertices of the context
+	auto path = AStar::Search(graph, context, GridState(0, 0).GetUniqueID(), GridState(2, 0).GetUniqueID(), CalcHeuristicFunc_t<GridState>(GridManhattan));
+	ASSERT_EQ(path.size(), 3);
+	ASSERT_TRUE(context.IsVisited(path.back()->vertex_index_));
+
+	// records of the previous query read as fresh in the next one
+	path = AStar::Search(graph, context, GridState(0, 5).GetUniqueID(), GridState(0, 6).GetUniqueID(), CalcHeuristicFunc_t<GridState>(GridManhattan));
+	ASSERT_EQ(path.size(), 2);
+	auto old_goal = graph.GetVertexFromID(GridState(2, 0).GetUniqueID());
+	ASSERT_FALSE(context.IsVisited(old_goal->vertex_index_));
+	ASSERT_EQ(static_cast<const SearchContext&>(context).GetSearchInfo(old_goal->vertex_index_).g_astar_, 0.0);
+	ASSERT_EQ(context.GetSearchInfo(path.back()->vertex_index_).g_astar_, 1.0);
+
+	// results are the same as with a fresh context
+	for(int k = 0; k < 5; k++)
+	{
+		SearchContext fresh;
+		auto reused_path = AStar::Search(graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+		auto fresh_path = AStar::Search(graph, fresh, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+		ASSERT_EQ(reused_path, fresh_path);
+	}
+}
+
+struct ManhattanFunctor
+{
+	double operator()(const GridState& node1, const GridState& node2) const
+	{
+		return std::abs(node1.x_ - node2.x_) + std::abs(node1.y_ - node2.y_);
+	}
+};
+
+TEST_F(SearchContextTest, HeuristicCallables)
+{
+	SearchContext context;
+	auto reference = AStar::Search(graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+
+	auto lambda_path = AStar::Search(graph, context, 0, 31, [](const GridState& node1, const GridState& node2) {
+		return static_cast<double>(std::abs(node1.x_ - node2.x_) + std::abs(node1.y_ - node2.y_));
+	});
+	auto functor_path = AStar::Search(graph, 0, 31, ManhattanFunctor());
+	auto fptr_path = AStar::Search(graph.Freeze(), 0, 31, &GridManhattan);
+	auto indexed_path = AStar::Search<IndexedDaryHeap<4>>(graph, context, 0, 31, ManhattanFunctor());
+
+	ASSERT_EQ(lambda_path, reference);
+	ASSERT_EQ(functor_path, reference);
+	ASSERT_EQ(fptr_path.size(), reference.size());
+	ASSERT_EQ(indexed_path.size(), reference.size());
+
+	// the states are passed by reference, no copy is made
+	const GridState* expected_goal = &graph.GetVertexFromID(31)->state_;
+	bool goal_by_reference = true;
+	AStar::Search(graph, context, 0, 31, [&](const GridState&, const GridState& goal) {
+		goal_by_reference = goal_by_reference && (&goal == expected_goal);
+		return 0.0;
+	});
+	ASSERT_TRUE(goal_by_reference);
+}
+
+TEST_F(SearchContextTest, HeuristicOncePerVertex)
+{
+	SearchContext context;
+	auto reference = AStar::Search(graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+
+	// the heuristic is evaluated when a vertex is reached first, not on every cost update
+	std::vector<int> evaluations(32 * 32, 0);
+	auto path = AStar::Search(graph, context, 0, 31, [&](const GridState& node, const GridState& goal) {
+		++evaluations[node.GetUniqueID()];
+		return GridManhattan(node, goal);
+	});
+	ASSERT_EQ(path, reference);
+	for(auto count : evaluations)
+		ASSERT_LE(count, 1);
+}
+
+TEST_F(SearchContextTest, ResultAndStatistics)
+{
+	SearchContext context;
+	auto result = AStar::FindPath(graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+
+	ASSERT_TRUE(result.found_);
+	ASSERT_EQ(result.path_, AStar::Search(graph, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan)));
+	ASSERT_EQ(result.cost_, result.path_.size() - 1);
+	ASSERT_GT(result.statistics_.expanded_num_, 0);
+	ASSERT_GE(result.statistics_.pushed_num_, result.statistics_.expanded_num_ + result.statistics_.stale_pop_num_);
+	ASSERT_LE(result.statistics_.max_openlist_size_, result.statistics_.pushed_num_);
+	ASSERT_GE(result.statistics_.search_time_, 0);
+
+	auto csr_result = Dijkstra::FindPath(graph.Freeze(), context, 0, 31);
+	ASSERT_EQ(csr_result.cost_, result.cost_);
+	ASSERT_EQ(csr_result.path_.size(), result.path_.size());
+
+	auto missing = Dijkstra::FindPath(graph, 0, 4096);
+	ASSERT_FALSE(missing.found_);
+	ASSERT_TRUE(missing.path_.empty());
+}
+
+TEST_F(SearchContextTest, LogHook)
+{
+	std::vector<SearchLogRecord> records;
+	SetSearchLogHook([&records](const SearchLogRecord &record) { records.push_back(record); });
+
+	SearchContext context;
+	auto path = Dijkstra::Search(graph, context, 0, 31);
+	Dijkstra::Search(graph, context, 0, GridState(16, 0).GetUniqueID());
+	SetSearchLogHook(nullptr);
+	AStar::Search(graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan));
+
+	// vertex (16, 0) is part of the wall and doesn't exist, no search is run for it
+	ASSERT_EQ(records.size(), 1);
+	ASSERT_STREQ(records[0].algorithm_, "Dijkstra");
+	ASSERT_TRUE(records[0].found_);
+	ASSERT_EQ(records[0].goal_id_, 31);
+	ASSERT_EQ(records[0].path_length_, path.size());
+	ASSERT_EQ(records[0].cost_, path.size() - 1);
+}
+
+struct CountingVisitor
+{
+	std::size_t push_num = 0;
+	std::size_t pop_num = 0;
+	std::size_t expand_num = 0;
+	std::size_t relax_num = 0;
+	std::vector<uint32_t> goals;
+
+	void OnPush(uint32_t, double) { ++push_num; }
+	void OnPop(uint32_t) { ++pop_num; }
+	bool OnExpand(uint32_t) { return ++expand_num, true; }
+	void OnRelax(uint32_t, uint32_t, double) { ++relax_num; }
+	void OnGoal(uint32_t vertex) { goals.push_back(vertex); }
+};
+
+struct ExpansionLimit
+{
+	std::size_t limit;
+	std::size_t expand_num;
+
+	void OnPush(uint32_t, double) {}
+	void OnPop(uint32_t) {}
+	bool OnExpand(uint32_t) { return expand_num++ < limit; }
+	void OnRelax(uint32_t, uint32_t, double) {}
+	void OnGoal(uint32_t) {}
+};
+
+TEST_F(SearchContextTest, Visitor)
+{
+	SearchContext context;
+	CountingVisitor visitor;
+	auto result = AStar::FindPath(graph, context, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan), visitor);
+	auto &statistics = result.statistics_;
+
+	// the visitor sees the same search as the statistics
+	ASSERT_EQ(result.path_, AStar::Search(graph, 0, 31, CalcHeuristicFunc_t<GridState>(GridManhattan)));
+	ASSERT_EQ(visitor.push_num, statistics.pushed_num_);
+	ASSERT_EQ(visitor.expand_num, statistics.expanded_num_);
+	ASSERT_EQ(visitor.pop_num, statistics.expanded_num_ + statistics.stale_pop_num_ + 1);
+	ASSERT_EQ(visitor.relax_num, statistics.pushed_num_ - 1);
+	ASSERT_EQ(visitor.goals.size(), 1);
+	ASSERT_EQ(visitor.goals[0], graph.GetVertexFromID(31)->vertex_index_);
+
+	// a visitor can be passed as a temporary and stop the search early
+	ASSERT_TRUE(Dijkstra::Search(graph, context, 0, 31, ExpansionLimit{10, 0}).empty());
+	ASSERT_EQ(context.GetStatistics().expanded_num_, 10);
+	ASSERT_EQ(Dijkstra::Search(graph, context, 0, 31, ExpansionLimit{2048, 0}), Dijkstra::Search(graph, context, 0, 31));
+}
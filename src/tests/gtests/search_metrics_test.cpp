@@ -0,0 +1,172 @@
+/*
+ * search_metrics_test.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Description:
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <thread>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/search_metrics.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct MetricsCell
+{
+	MetricsCell(int32_t x, int32_t y):x_(x), y_(y){};
+
+	int32_t x_;
+	int32_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 16 + x_;
+	}
+};
+
+TEST(SearchMetricsTest, HistogramBuckets)
+{
+	// buckets are contiguous and every value falls into the bucket it's bounded by
+	for(uint64_t value = 0; value < 5000; ++value)
+	{
+		uint32_t index = MetricHistogram::GetBucketIndex(value);
+		ASSERT_GE(MetricHistogram::GetBucketUpperBound(index), value);
+		if(index > 0)
+		{
+			ASSERT_LT(MetricHistogram::GetBucketUpperBound(index - 1), value);
+		}
+	}
+	ASSERT_EQ(MetricHistogram::GetBucketIndex(MetricHistogram::MaxValue), MetricHistogram::BucketNum - 1);
+	ASSERT_EQ(MetricHistogram::GetBucketIndex(uint64_t(-1)), MetricHistogram::BucketNum - 1);
+
+	MetricHistogram histogram;
+	for(uint64_t value = 1; value <= 1000; ++value)
+		histogram.Record(value * 1000);
+
+	ASSERT_EQ(histogram.GetCount(), 1000);
+	ASSERT_EQ(histogram.GetMax(), 1000000);
+	ASSERT_DOUBLE_EQ(histogram.GetMean(), 500500);
+	ASSERT_GE(histogram.GetValueAtPercentile(50), 500000);
+	ASSERT_LE(histogram.GetValueAtPercentile(50), 500000 * 1.04);
+	ASSERT_GE(histogram.GetValueAtPercentile(99), 990000);
+	ASSERT_LE(histogram.GetValueAtPercentile(99), 990000 * 1.04);
+	ASSERT_EQ(histogram.GetValueAtPercentile(100), 1000000);
+	ASSERT_EQ(MetricHistogram().GetValueAtPercentile(50), 0);
+}
+
+TEST(SearchMetricsTest, RecordQueries)
+{
+	Graph_t<MetricsCell> graph;
+	for(int32_t y = 0; y < 16; y++)
+		for(int32_t x = 0; x < 16; x++)
+		{
+			if(x + 1 < 16)
+				graph.AddUndirectedEdge(MetricsCell(x, y), MetricsCell(x + 1, y), 1.0);
+			if(y + 1 < 16)
+				graph.AddUndirectedEdge(MetricsCell(x, y), MetricsCell(x, y + 1), 1.0);
+		}
+	auto heuristic = [](const MetricsCell &node, const MetricsCell &goal) {
+		return std::abs(node.x_ - goal.x_) + std::abs(node.y_ - goal.y_);
+	};
+
+	SearchMetrics &metrics = GetSearchMetrics();
+	metrics.Clear();
+
+	// nothing is recorded while the metrics are disabled
+	Dijkstra::Search(graph, 0, 15);
+	for(const auto &engine : metrics.GetSnapshot())
+		ASSERT_EQ(engine.query_num_, 0);
+
+	metrics.Enable();
+	std::vector<std::thread> threads;
+	for(int i = 0; i < 4; ++i)
+		threads.emplace_back([&graph, &heuristic]() {
+			for(int j = 0; j < 25; ++j)
+			{
+				Dijkstra::Search(graph, 0, 15);
+				AStar::Search(graph, 0, 15, heuristic);
+			}
+		});
+	for(auto &thread : threads)
+		thread.join();
+	SearchContext context;
+	auto result = Dijkstra::FindPath(graph, context, 0, 15);
+	metrics.Enable(false);
+
+	auto snapshot = metrics.GetSnapshot();
+	ASSERT_EQ(snapshot.size(), 2);
+	ASSERT_EQ(snapshot[0].algorithm_, "AStar");
+	ASSERT_EQ(snapshot[0].query_num_, 100);
+	ASSERT_EQ(snapshot[0].found_num_, 100);
+	ASSERT_EQ(snapshot[1].algorithm_, "Dijkstra");
+	ASSERT_EQ(snapshot[1].query_num_, 101);
+	ASSERT_EQ(snapshot[1].latency_.GetCount(), 101);
+
+	// every Dijkstra query expands the same vertices
+	ASSERT_EQ(snapshot[1].expanded_num_.GetMax(), result.statistics_.expanded_num_);
+	ASSERT_DOUBLE_EQ(snapshot[1].expanded_num_.GetMean(), result.statistics_.expanded_num_);
+	ASSERT_EQ(snapshot[1].max_openlist_size_.GetMax(), result.statistics_.max_openlist_size_);
+	ASSERT_LT(snapshot[0].expanded_num_.GetMax(), snapshot[1].expanded_num_.GetMax());
+
+	std::size_t exported = 0;
+	metrics.Export([&exported](const SearchEngineMetrics &engine) { exported += engine.query_num_; });
+	ASSERT_EQ(exported, 201);
+
+	std::ostringstream text;
+	metrics.WriteSnapshot(text);
+	ASSERT_NE(text.str().find("Dijkstra: queries 101, found 101"), std::string::npos);
+	ASSERT_NE(text.str().find("p999"), std::string::npos);
+
+	metrics.Clear();
+	ASSERT_EQ(metrics.GetSnapshot()[0].query_num_, 0);
+	ASSERT_EQ(metrics.GetSnapshot()[0].latency_.GetCount(), 0);
+}
+
+TEST(SearchMetricsTest, ExitedThreads)
+{
+	Graph_t<MetricsCell> graph;
+	graph.AddEdge(MetricsCell(0, 0), MetricsCell(1, 0), 1.0);
+
+	SearchMetrics &metrics = GetSearchMetrics();
+	metrics.Clear();
+	metrics.Enable();
+
+	// the shards of exited threads keep their counts and are taken by new threads
+	std::thread([&graph]() { Dijkstra::Search(graph, 0, 1); }).join();
+	std::size_t shard_num = metrics.GetShardNumber();
+	for(int i = 0; i < 20; ++i)
+		std::thread([&graph]() { Dijkstra::Search(graph, 0, 1); }).join();
+	metrics.Enable(false);
+
+	ASSERT_EQ(metrics.GetShardNumber(), shard_num);
+	uint64_t query_num = 0;
+	for(const auto &engine : metrics.GetSnapshot())
+	{
+		if(engine.algorithm_ == "Dijkstra")
+			query_num = engine.query_num_;
+	}
+	ASSERT_EQ(query_num, 21);
+}
+
+TEST(SearchMetricsTest, RecordUntilExit)
+{
+	// the main thread returns its shard after the static objects are destroyed, and a
+	//	detached thread may still record while the process exits
+	EXPECT_EXIT({
+		Graph_t<MetricsCell> graph;
+		graph.AddEdge(MetricsCell(0, 0), MetricsCell(1, 0), 1.0);
+		GetSearchMetrics().Enable();
+		Dijkstra::Search(graph, 0, 1);
+		std::thread([]() { GetSearchMetrics().Record("Detached", true, SearchStatistics()); }).detach();
+		std::exit(0);
+	}, testing::ExitedWithCode(0), "");
+}
@@ -0,0 +1,172 @@
+/* 
+ * search_workspace_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+// count the allocations of the test program to check that searches with a warm workspace
+//	don't allocate. This file is built into an executable of its own, all forms of the
+//	global new and delete are replaced so that every allocation is paired with a free().
+static std::atomic<std::size_t> allocation_count(0);
+
+static void *CountedAlloc(std::size_t size) noexcept
+{
+	++allocation_count;
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new(std::size_t size)
+{
+	void *ptr = CountedAlloc(size);
+	if (ptr == nullptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return CountedAlloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return CountedAlloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+	std::free(ptr);
+}
+
+struct WorkspaceCell
+{
+	WorkspaceCell(int32_t x, int32_t y):x_(x), y_(y){};
+
+	int32_t x_;
+	int32_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 32 + x_;
+	}
+};
+
+struct SearchWorkspaceTest: testing::Test
+{
+	Graph_t<WorkspaceCell> graph;
+
+	SearchWorkspaceTest()
+	{
+		// 32x32 4-connected grid with costs varying by row
+		for(int32_t y = 0; y < 32; y++)
+			for(int32_t x = 0; x < 32; x++)
+			{
+				if(x + 1 < 32)
+				{
+					graph.AddEdge(WorkspaceCell(x, y), WorkspaceCell(x + 1, y), 1.0 + y % 3);
+					graph.AddEdge(WorkspaceCell(x + 1, y), WorkspaceCell(x, y), 1.0 + y % 3);
+				}
+				if(y + 1 < 32)
+				{
+					graph.AddEdge(WorkspaceCell(x, y), WorkspaceCell(x, y + 1), 1.0);
+					graph.AddEdge(WorkspaceCell(x, y + 1), WorkspaceCell(x, y), 1.0);
+				}
+			}
+	}
+
+	static double Manhattan(const WorkspaceCell &node, const WorkspaceCell &goal)
+	{
+		return std::abs(node.x_ - goal.x_) + std::abs(node.y_ - goal.y_);
+	}
+};
+
+TEST_F(SearchWorkspaceTest, SamePathAsContextSearch)
+{
+	SearchWorkspace<> workspace;
+	SearchContext context;
+
+	ASSERT_TRUE(AStar::Search(graph, workspace, 0, 1023, &Manhattan));
+	auto reference = AStar::Search(graph, context, 0, 1023, &Manhattan);
+	ASSERT_EQ(workspace.path_.size(), reference.size());
+	for(std::size_t i = 0; i < reference.size(); i++)
+		ASSERT_EQ(graph.GetVertexFromIndex(workspace.path_[i]), reference[i]);
+
+	auto csr = graph.Freeze();
+	SearchWorkspace<IndexedDaryHeap<4>> csr_workspace;
+	ASSERT_TRUE(Dijkstra::Search(csr, csr_workspace, 0, 1023));
+	ASSERT_EQ(csr_workspace.path_, Dijkstra::Search<IndexedDaryHeap<4>>(csr, 0, 1023));
+
+	// unknown vertices clear the path of the last search
+	ASSERT_FALSE(AStar::Search(graph, workspace, 0, 5000, &Manhattan));
+	ASSERT_TRUE(workspace.path_.empty());
+}
+
+TEST_F(SearchWorkspaceTest, WarmSearchesDontAllocate)
+{
+	auto csr = graph.Freeze();
+	SearchWorkspace<> workspace;
+	SearchWorkspace<IndexedDaryHeap<4>> csr_workspace;
+	const uint64_t goals[] = {1023, 31, 992, 500, 17};
+
+	// the first round grows the buffers to the size the queries need
+	for(int round = 0; round < 2; round++)
+	{
+		std::size_t allocation_num = allocation_count;
+		for(auto goal : goals)
+		{
+			ASSERT_TRUE(AStar::Search(graph, workspace, 0, goal, &Manhattan));
+			ASSERT_TRUE(Dijkstra::Search(graph, workspace, goal, 0));
+			ASSERT_TRUE(AStar::Search(csr, csr_workspace, 0, goal, &Manhattan));
+		}
+		if(round == 0)
+			ASSERT_GT(allocation_count - allocation_num, 0);
+		else
+			ASSERT_EQ(allocation_count - allocation_num, 0);
+	}
+}
@@ -0,0 +1,141 @@
+/* 
+ * small_vector_test.cpp
+ * 
+ * Created on: Oct 16, 2026
+ * Description: 
+ * 
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "graph/graph.hpp"
+
+using namespace librav;
+
+struct SmallVectorTestState
+{
+	SmallVectorTestState(uint64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+TEST(SmallVectorTest, GrowsBeyondInlineStorage)
+{
+	GraphArena arena;
+	SmallVector<std::string, 2, ArenaAllocator<std::string>> vec{ArenaAllocator<std::string>(&arena)};
+
+	vec.emplace_back("a");
+	vec.emplace_back("b");
+	ASSERT_EQ(vec.capacity(), 2);
+	ASSERT_EQ(arena.GetReservedSize(), 0);
+
+	// elements are moved to the arena once the inline storage is full
+	for (int i = 0; i < 10; i++)
+		vec.push_back(std::to_string(i));
+	ASSERT_EQ(vec.size(), 12);
+	ASSERT_GT(arena.GetReservedSize(), 0);
+	ASSERT_EQ(vec.front(), "a");
+	ASSERT_EQ(vec[1], "b");
+	ASSERT_EQ(vec.back(), "9");
+
+	vec.pop_back();
+	ASSERT_EQ(vec.back(), "8");
+
+	auto copy = vec;
+	vec.clear();
+	ASSERT_TRUE(vec.empty());
+	ASSERT_EQ(copy.size(), 11);
+	ASSERT_EQ(copy[2], "0");
+}
+
+TEST(SmallVectorTest, PushAliasedElement)
+{
+	// the element pushed is moved out of the inline storage while the vector grows
+	SmallVector<std::string, 2> vec;
+	vec.push_back(std::string(32, 'a'));
+	vec.push_back(std::string(32, 'b'));
+	vec.push_back(vec[0]);
+	ASSERT_EQ(vec.size(), 3);
+	ASSERT_EQ(vec[2], std::string(32, 'a'));
+
+	// and out of a heap buffer
+	vec.push_back(vec[1]);
+	vec.emplace_back(vec[3]);
+	ASSERT_EQ(vec.size(), 5);
+	ASSERT_EQ(vec[4], std::string(32, 'b'));
+}
+
+TEST(SmallVectorTest, Move)
+{
+	GraphArena arena;
+	typedef SmallVector<std::string, 2, ArenaAllocator<std::string>> VectorType;
+
+	// inline elements are moved one by one
+	VectorType small{ArenaAllocator<std::string>(&arena)};
+	small.push_back("a");
+	VectorType small_moved(std::move(small));
+	ASSERT_TRUE(small.empty());
+	ASSERT_EQ(small_moved.size(), 1);
+	ASSERT_EQ(small_moved[0], "a");
+
+	// a heap buffer is taken over
+	VectorType large{ArenaAllocator<std::string>(&arena)};
+	for (int i = 0; i < 10; i++)
+		large.push_back(std::to_string(i));
+	const std::string *data = &large[0];
+	VectorType large_moved(std::move(large));
+	ASSERT_TRUE(large.empty());
+	ASSERT_EQ(large.capacity(), 2);
+	ASSERT_EQ(&large_moved[0], data);
+	ASSERT_EQ(large_moved.size(), 10);
+
+	small_moved = std::move(large_moved);
+	ASSERT_EQ(&small_moved[0], data);
+	ASSERT_EQ(small_moved.back(), "9");
+	ASSERT_TRUE(large_moved.empty());
+
+	// the moved-from vectors can be used again
+	large_moved.push_back("b");
+	small_moved = std::move(large_moved);
+	ASSERT_EQ(small_moved.size(), 1);
+	ASSERT_EQ(small_moved[0], "b");
+}
+
+TEST(SmallVectorTest, VertexEdgeLists)
+{
+	Graph_t<SmallVectorTestState> graph;
+
+	// vertex 0 has more neighbours than fit inline
+	const uint64_t neighbour_num = 3 * Vertex_t<SmallVectorTestState, double>::InlineEdgeNum;
+	for (uint64_t i = 1; i <= neighbour_num; i++)
+	{
+		graph.AddEdge(SmallVectorTestState(0), SmallVectorTestState(i), i);
+		graph.AddEdge(SmallVectorTestState(i), SmallVectorTestState(0), i);
+	}
+
+	auto vertex = graph.GetVertexFromID(0);
+	ASSERT_EQ(vertex->edges_to_.size(), neighbour_num);
+	ASSERT_EQ(vertex->edges_from_.size(), neighbour_num);
+	for (uint64_t i = 1; i <= neighbour_num; i++)
+		ASSERT_EQ(vertex->GetEdgeCost(*graph.GetVertexFromID(i)), i);
+
+	graph.RemoveEdge(SmallVectorTestState(0), SmallVectorTestState(1));
+	graph.RemoveVertex(SmallVectorTestState(2));
+	ASSERT_EQ(vertex->edges_to_.size(), neighbour_num - 2);
+	ASSERT_EQ(vertex->edges_from_.size(), neighbour_num - 1);
+	ASSERT_FALSE(vertex->CheckNeighbour(graph.GetVertexFromID(1)));
+
+	ASSERT_EQ(graph.GetGraphEdges().size(), 2 * neighbour_num - 3);
+	ASSERT_EQ(graph.GetGraphUndirectedEdges().size(), neighbour_num - 1);
+	for (const auto &edge : graph.GetGraphEdges())
+		ASSERT_TRUE(edge.src_->CheckNeighbour(edge.dst_));
+}
@@ -0,0 +1,196 @@
+/*
+ * graph_build_benchmark.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: compare graph construction and vertex lookup with different id index policies
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+// standard libaray
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+#include <thread>
+
+// user
+#include "graph/graph.hpp"
+#include "graph/graph_builder.hpp"
+
+using namespace librav;
+
+// cells of a grid, numbered row by row
+struct GridCell
+{
+	GridCell(int64_t x, int64_t y):x_(x), y_(y){};
+
+	int64_t x_;
+	int64_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 1000 + x_;
+	}
+};
+
+// cells with scattered ids, like vertices imported from a road network database
+struct SparseCell
+{
+	SparseCell(int64_t x, int64_t y):x_(x), y_(y){};
+
+	int64_t x_;
+	int64_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return ((y_ * 1000 + x_) * 0x5bd1e995) & 0xffffffffffLL;
+	}
+};
+
+template <typename CellType, typename IDIndexType>
+void RunBenchmark(const char *name, int64_t grid_size)
+{
+	auto t_start = std::chrono::steady_clock::now();
+
+	// 4-connected grid, the ids of the grid cells are smaller than grid_size * grid_size
+	Graph_t<CellType, double, IDIndexType> graph;
+	graph.ReserveIDRange(grid_size * grid_size);
+	std::size_t edge_num = 0;
+	for (int64_t y = 0; y < grid_size; y++)
+		for (int64_t x = 0; x < grid_size; x++)
+		{
+			if (x + 1 < grid_size)
+			{
+				graph.AddEdge(CellType(x, y), CellType(x + 1, y), 1.0);
+				graph.AddEdge(CellType(x + 1, y), CellType(x, y), 1.0);
+				edge_num += 2;
+			}
+			if (y + 1 < grid_size)
+			{
+				graph.AddEdge(CellType(x, y), CellType(x, y + 1), 1.0);
+				graph.AddEdge(CellType(x, y + 1), CellType(x, y), 1.0);
+				edge_num += 2;
+			}
+		}
+
+	auto t_built = std::chrono::steady_clock::now();
+
+	// look up the vertices in random order, as a search or a stream of cost updates does
+	std::vector<uint64_t> ids;
+	for (int64_t y = 0; y < grid_size; y++)
+		for (int64_t x = 0; x < grid_size; x++)
+			ids.push_back(CellType(x, y).GetUniqueID());
+	std::shuffle(ids.begin(), ids.end(), std::mt19937(0));
+
+	auto t_shuffled = std::chrono::steady_clock::now();
+
+	std::size_t found_num = 0;
+	for (auto id : ids)
+		found_num += (graph.GetVertexFromID(id) != nullptr);
+
+	auto t_looked_up = std::chrono::steady_clock::now();
+
+	graph.ClearGraph();
+
+	auto t_cleared = std::chrono::steady_clock::now();
+
+	double build_time = std::chrono::duration<double>(t_built - t_start).count();
+	double lookup_time = std::chrono::duration<double>(t_looked_up - t_shuffled).count();
+	double clear_time = std::chrono::duration<double>(t_cleared - t_looked_up).count();
+	std::cout << name << ": " << edge_num / build_time / 1.0e6 << " M edges/s to build, "
+			  << lookup_time * 1.0e9 / (grid_size * grid_size) << " ns per GetVertexFromID (" << found_num << " found), "
+			  << clear_time * 1.0e3 << " ms to clear" << std::endl;
+}
+
+// vertices with many random successors, built edge by edge or as one batch
+void RunBulkBenchmark(int64_t vertex_num, int64_t degree)
+{
+	typedef SparseCell CellType;
+
+	std::vector<std::tuple<CellType, CellType, double>> edges;
+	std::mt19937 rng(0);
+	std::uniform_int_distribution<int64_t> vtx(0, vertex_num - 1);
+	for (int64_t i = 0; i < vertex_num; i++)
+		for (int64_t k = 0; k < degree; k++)
+			edges.emplace_back(CellType(i, 0), CellType(vtx(rng), 0), 1.0);
+
+	auto t_start = std::chrono::steady_clock::now();
+	Graph_t<CellType> single_graph;
+	for (const auto &edge : edges)
+		single_graph.AddEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+	auto t_single = std::chrono::steady_clock::now();
+
+	Graph_t<CellType> bulk_graph;
+	bulk_graph.Reserve(vertex_num, edges.size());
+	std::size_t added_num = bulk_graph.AddEdges(edges);
+	auto t_bulk = std::chrono::steady_clock::now();
+
+	double single_time = std::chrono::duration<double>(t_single - t_start).count();
+	double bulk_time = std::chrono::duration<double>(t_bulk - t_single).count();
+	std::cout << "degree " << degree << ", AddEdge : " << edges.size() / single_time / 1.0e6 << " M edges/s" << std::endl;
+	std::cout << "degree " << degree << ", AddEdges: " << edges.size() / bulk_time / 1.0e6 << " M edges/s ("
+			  << added_num << " of " << edges.size() << " added)" << std::endl;
+}
+
+// grid built from a neighbour generator that does an expensive check per edge, like a
+//	collision check of the motion between two cells
+void RunGeneratorBenchmark(int64_t grid_size, std::size_t thread_num)
+{
+	typedef GridCell CellType;
+
+	std::vector<CellType> cells;
+	for (int64_t y = 0; y < grid_size; y++)
+		for (int64_t x = 0; x < grid_size; x++)
+			cells.emplace_back(x, y);
+
+	auto get_neighbours = [grid_size](CellType cell) {
+		std::vector<std::tuple<CellType, double>> neighbours;
+		const int64_t dx[] = {1, -1, 0, 0};
+		const int64_t dy[] = {0, 0, 1, -1};
+		for (int i = 0; i < 4; i++)
+		{
+			CellType next(cell.x_ + dx[i], cell.y_ + dy[i]);
+			if (next.x_ < 0 || next.x_ >= grid_size || next.y_ < 0 || next.y_ >= grid_size)
+				continue;
+			double clearance = 0;
+			for (int k = 1; k <= 200; k++)
+				clearance += std::sin(next.x_ * 0.01 * k) * std::cos(next.y_ * 0.01 * k);
+			if (clearance > -1.0e9)
+				neighbours.emplace_back(next, 1.0);
+		}
+		return neighbours;
+	};
+
+	auto t_start = std::chrono::steady_clock::now();
+	Graph_t<CellType> graph;
+	std::size_t edge_num = AddGeneratedEdges(graph, cells, get_neighbours, thread_num);
+	auto t_built = std::chrono::steady_clock::now();
+
+	double build_time = std::chrono::duration<double>(t_built - t_start).count();
+	std::cout << "generator, " << thread_num << " threads: " << build_time * 1.0e3 << " ms to build "
+			  << edge_num << " edges" << std::endl;
+}
+
+int main()
+{
+	const int64_t grid_size = 1000;
+
+	RunBenchmark<GridCell, StdIDIndex>("grid ids,   StdIDMap  ", grid_size);
+	RunBenchmark<GridCell, FlatIDIndex>("grid ids,   FlatIDMap ", grid_size);
+	RunBenchmark<GridCell, DenseIDIndex>("grid ids,   DenseIDMap", grid_size);
+	RunBenchmark<SparseCell, StdIDIndex>("sparse ids, StdIDMap  ", grid_size);
+	RunBenchmark<SparseCell, FlatIDIndex>("sparse ids, FlatIDMap ", grid_size);
+
+	RunBulkBenchmark(250000, 4);
+	RunBulkBenchmark(4000, 256);
+
+	for (std::size_t thread_num = 1; thread_num <= std::thread::hardware_concurrency(); thread_num *= 2)
+		RunGeneratorBenchmark(200, thread_num);
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * lpastar_benchmark.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: compare LPA* replanning latency with rerunning A* from scratch
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+// standard libaray
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+
+// user
+#include "graph/graph.hpp"
+#include "graph/algorithms/astar.hpp"
+#include "graph/algorithms/lpastar.hpp"
+
+using namespace librav;
+
+struct GridCell
+{
+	GridCell(int64_t x, int64_t y):x_(x), y_(y){};
+
+	int64_t x_;
+	int64_t y_;
+
+	int64_t GetUniqueID() const
+	{
+		return y_ * 1000 + x_;
+	}
+};
+
+struct GridManhattan
+{
+	double operator()(const GridCell &a, const GridCell &b) const
+	{
+		return std::abs(a.x_ - b.x_) + std::abs(a.y_ - b.y_);
+	}
+};
+
+int main()
+{
+	const int64_t grid_size = 200;
+	const int replan_num = 50;
+	const int change_num = 5;
+
+	// 4-connected grid with random integer costs
+	Graph_t<GridCell> graph;
+	std::vector<std::pair<GridCell, GridCell>> edges;
+	std::mt19937 rng(0);
+	std::uniform_int_distribution<int> cost(1, 10);
+	for (int64_t y = 0; y < grid_size; y++)
+		for (int64_t x = 0; x < grid_size; x++)
+		{
+			if (x + 1 < grid_size)
+			{
+				edges.emplace_back(GridCell(x, y), GridCell(x + 1, y));
+				edges.emplace_back(GridCell(x + 1, y), GridCell(x, y));
+			}
+			if (y + 1 < grid_size)
+			{
+				edges.emplace_back(GridCell(x, y), GridCell(x, y + 1));
+				edges.emplace_back(GridCell(x, y + 1), GridCell(x, y));
+			}
+		}
+	for (auto &edge : edges)
+		graph.AddEdge(edge.first, edge.second, cost(rng));
+
+	const uint64_t start_id = GridCell(0, 0).GetUniqueID();
+	const uint64_t goal_id = GridCell(grid_size - 1, grid_size - 1).GetUniqueID();
+	const uint32_t start_idx = graph.GetVertexFromID(start_id)->vertex_index_;
+	const uint32_t goal_idx = graph.GetVertexFromID(goal_id)->vertex_index_;
+
+	LPAStar<GridCell, double, GridManhattan> lpastar(graph, GridManhattan());
+	lpastar.SetStartGoal(start_id, goal_id);
+
+	auto t_start = std::chrono::steady_clock::now();
+	lpastar.ComputeShortestPath();
+	auto t_end = std::chrono::steady_clock::now();
+	std::cout << "initial LPA* search: " << std::chrono::duration<double>(t_end - t_start).count() * 1000.0 << " ms, "
+			  << lpastar.GetExpansionNumber() << " expansions" << std::endl;
+
+	// change a few edge costs and replan, A* runs the same engine as AStar::Search() without printouts
+	SearchContext context;
+	double lpastar_time = 0;
+	double astar_time = 0;
+	std::size_t lpastar_expansions = 0;
+	std::uniform_int_distribution<std::size_t> edge_idx(0, edges.size() - 1);
+	for (int i = 0; i < replan_num; i++)
+	{
+		for (int k = 0; k < change_num; k++)
+		{
+			auto &edge = edges[edge_idx(rng)];
+			lpastar.UpdateEdgeCost(edge.first, edge.second, cost(rng));
+		}
+
+		t_start = std::chrono::steady_clock::now();
+		lpastar.ComputeShortestPath();
+		t_end = std::chrono::steady_clock::now();
+		lpastar_time += std::chrono::duration<double>(t_end - t_start).count();
+		lpastar_expansions += lpastar.GetExpansionNumber();
+
+		t_start = std::chrono::steady_clock::now();
+		BestFirstSearch<PriorityQueue<uint32_t>>(graph, context, start_idx, goal_idx, GridManhattan());
+		t_end = std::chrono::steady_clock::now();
+		astar_time += std::chrono::duration<double>(t_end - t_start).count();
+
+		if (lpastar.GetPathCost() != context.GetSearchInfo(goal_idx).g_astar_)
+			std::cout << "cost mismatch at replan " << i << std::endl;
+	}
+
+	std::cout << "LPA* replan: " << lpastar_time * 1000.0 / replan_num << " ms/replan, "
+			  << lpastar_expansions / replan_num << " expansions/replan" << std::endl;
+	std::cout << "A* rerun:    " << astar_time * 1000.0 / replan_num << " ms/replan" << std::endl;
+
+	return 0;
+}
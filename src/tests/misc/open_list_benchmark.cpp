@@ -0,0 +1,113 @@
+/*
+ * open_list_benchmark.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Description: compare heap size and pop throughput of the A* open lists
+ *
+ * Copyright (c) 2017 Ruixiang Du (rdu)
+ */
+
+// standard libaray
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+
+// user
+#include "graph/graph.hpp"
+#include "graph/algorithms/dijkstra.hpp"
+
+using namespace librav;
+
+struct BenchmarkState
+{
+	BenchmarkState(int64_t id):id_(id){};
+
+	int64_t id_;
+
+	int64_t GetUniqueID() const
+	{
+		return id_;
+	}
+};
+
+// wraps an open list to record the number of pops and the peak size
+template <typename OpenListType>
+struct CountingOpenList : public OpenListType
+{
+	static std::size_t pops;
+	static std::size_t max_size;
+
+	inline void put(uint32_t item, double priority)
+	{
+		OpenListType::put(item, priority);
+		if (OpenListType::size() > max_size)
+			max_size = OpenListType::size();
+	}
+
+	inline uint32_t get()
+	{
+		++pops;
+		return OpenListType::get();
+	}
+};
+
+template <typename OpenListType>
+std::size_t CountingOpenList<OpenListType>::pops = 0;
+template <typename OpenListType>
+std::size_t CountingOpenList<OpenListType>::max_size = 0;
+
+template <typename OpenListType>
+void RunBenchmark(const std::string &name, const CsrGraph_t<BenchmarkState> &graph, int64_t vertex_num, int query_num)
+{
+	typedef CountingOpenList<OpenListType> QueueType;
+	QueueType::pops = 0;
+	QueueType::max_size = 0;
+
+	SearchContext context;
+	auto t_start = std::chrono::steady_clock::now();
+	for (int i = 0; i < query_num; i++)
+		Dijkstra::Search<QueueType>(graph, context, 0, vertex_num - 1 - i);
+	auto t_end = std::chrono::steady_clock::now();
+
+	double seconds = std::chrono::duration<double>(t_end - t_start).count();
+	std::cout << name << ": " << seconds * 1000.0 / query_num << " ms/query, "
+			  << QueueType::pops / query_num << " pops/query, "
+			  << QueueType::pops / seconds / 1.0e6 << " Mpops/s, "
+			  << "peak open list size " << QueueType::max_size << std::endl;
+}
+
+int main()
+{
+	const int64_t vertex_num = 20000;
+	const int degrees[] = {4, 16, 64};
+
+	for (auto degree : degrees)
+	{
+		Graph_t<BenchmarkState> graph;
+		std::mt19937 rng(degree);
+		std::uniform_int_distribution<int64_t> vtx(0, vertex_num - 1);
+		// integer costs so that the bucket queue finds optimal paths as well
+		std::uniform_int_distribution<int> cost(1, 100);
+
+		// a ring keeps the graph connected, random chords make it dense
+		for (int64_t i = 0; i < vertex_num; i++)
+		{
+			graph.AddEdge(BenchmarkState(i), BenchmarkState((i + 1) % vertex_num), cost(rng));
+			for (int k = 1; k < degree; k++)
+				graph.AddEdge(BenchmarkState(i), BenchmarkState(vtx(rng)), cost(rng));
+		}
+		auto csr = graph.Freeze();
+
+		std::cout << "------------- " << vertex_num << " vertices, " << csr.GetEdgeNumber() << " edges -------------" << std::endl;
+		RunBenchmark<PriorityQueue<uint32_t>>("PriorityQueue       ", csr, vertex_num, 20);
+		RunBenchmark<IndexedDaryHeap<2>>("IndexedDaryHeap<2>  ", csr, vertex_num, 20);
+		RunBenchmark<IndexedDaryHeap<4>>("IndexedDaryHeap<4>  ", csr, vertex_num, 20);
+		RunBenchmark<IndexedDaryHeap<8>>("IndexedDaryHeap<8>  ", csr, vertex_num, 20);
+		RunBenchmark<RadixHeap<double>>("RadixHeap<double>   ", csr, vertex_num, 20);
+		RunBenchmark<BucketQueue<double>>("BucketQueue<double> ", csr, vertex_num, 20);
+	}
+
+	return 0;
+}